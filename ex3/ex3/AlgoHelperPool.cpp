@@ -0,0 +1,71 @@
+#include "AlgoHelperPool.h"
+#include <algorithm>
+
+AlgoHelperPool::AlgoHelperPool(int helpersNum) : isStopping(false)
+{
+	helpers.reserve(helpersNum);
+	for (auto i = 0; i < helpersNum; i++)
+		helpers.emplace_back(&AlgoHelperPool::helperLoop, this);
+}
+
+AlgoHelperPool::~AlgoHelperPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(poolMutex);
+		isStopping = true;
+	}
+	newJobCondition.notify_all();
+	for (auto& helper : helpers) helper.join();
+}
+
+void AlgoHelperPool::run(void(*task)(void* context, int taskIndex), void* context, int tasksNum)
+{
+	if (tasksNum <= 0) return;
+
+	Job job = { task, context, tasksNum, 0, 0 };
+	std::unique_lock<std::mutex> lock(poolMutex);
+	if (tasksNum > 1 && !helpers.empty())
+	{
+		jobs.push_back(&job);
+		newJobCondition.notify_all();
+	}
+
+	while (job.nextTask < job.tasksNum)														/* the caller works too - it does not wait for the helpers to be free */
+	{
+		auto taskIndex = takeTask(job);
+		lock.unlock();
+		task(context, taskIndex);
+		lock.lock();
+		job.doneTasksNum++;
+	}
+
+	jobDoneCondition.wait(lock, [&]() { return job.doneTasksNum == job.tasksNum; });		/* the tasks that the helpers took */
+}
+
+void AlgoHelperPool::helperLoop()
+{
+	std::unique_lock<std::mutex> lock(poolMutex);
+	while (true)
+	{
+		newJobCondition.wait(lock, [&]() { return isStopping || !jobs.empty(); });
+		if (isStopping) return;
+
+		auto& job = *jobs.front();
+		auto taskIndex = takeTask(job);
+		lock.unlock();
+		job.task(job.context, taskIndex);
+		lock.lock();
+		if (++job.doneTasksNum == job.tasksNum) jobDoneCondition.notify_all();				/* under the lock - the caller may return (and the job end) right after it */
+	}
+}
+
+int AlgoHelperPool::takeTask(Job& job)
+{
+	auto taskIndex = job.nextTask++;
+	if (job.nextTask == job.tasksNum)
+	{
+		auto jobItr = std::find(jobs.begin(), jobs.end(), &job);
+		if (jobItr != jobs.end()) jobs.erase(jobItr);
+	}
+	return taskIndex;
+}
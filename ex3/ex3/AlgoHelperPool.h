@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "IBattleshipGameAlgo.h"
+
+/**
+ * \brief the helper threads of the tournament algos (see SetAlgorithmHelperPool) - one pool for the whole process, created once before the games start.
+ * every run() call is a job: its tasks are taken by the calling thread and by the free helpers, in the order of the jobs. a caller never waits for a busy pool -
+ * it runs the tasks that no helper took by itself. the task functions are algo code, and they run only inside run(), so the pool can outlive the algos
+ */
+class AlgoHelperPool final : public IAlgoHelperPool
+{
+public:
+	explicit AlgoHelperPool(int helpersNum);
+	~AlgoHelperPool();																		/* @assume - no run() call is in progress */
+
+	AlgoHelperPool(const AlgoHelperPool& otherPool) = delete;								/* deletes copy constructor */
+	AlgoHelperPool& operator=(const AlgoHelperPool& otherPool) = delete;					/* deletes copy assignment */
+
+	int helpersNum() const override { return static_cast<int>(helpers.size()); }
+	void run(void(*task)(void* context, int taskIndex), void* context, int tasksNum) override;
+
+private:
+	struct Job
+	{
+		void(*task)(void*, int);
+		void* context;
+		int tasksNum;
+		int nextTask;																		/* the first task that was not taken */
+		int doneTasksNum;
+	};
+
+	std::vector<std::thread> helpers;
+	std::deque<Job*> jobs;																	/* the jobs that have tasks no one took yet (the jobs are on their callers stacks) */
+	std::mutex poolMutex;
+	std::condition_variable newJobCondition;
+	std::condition_variable jobDoneCondition;
+	bool isStopping;
+
+	void helperLoop();
+
+	/* takes the next task of the job, and removes the job from the jobs queue if it was its last task. @assume - poolMutex is locked and the job has a task left */
+	int takeTask(Job& job);
+};
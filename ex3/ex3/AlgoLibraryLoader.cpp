@@ -0,0 +1,57 @@
+#include "AlgoLibraryLoader.h"
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
+
+#ifdef _WIN32
+
+const std::string AlgoLibraryLoader::LIB_EXTENSION(".dll");
+
+AlgoLibHandle AlgoLibraryLoader::open(const std::string& libPath)
+{
+	return LoadLibraryA(libPath.c_str()); // Notice: Unicode compatible version of LoadLibrary
+}
+
+void* AlgoLibraryLoader::getSymbol(AlgoLibHandle libHandle, const char* symbolName)
+{
+	return reinterpret_cast<void*>(GetProcAddress(libHandle, symbolName));
+}
+
+void AlgoLibraryLoader::close(AlgoLibHandle libHandle)
+{
+	FreeLibrary(libHandle);
+}
+
+std::string AlgoLibraryLoader::lastError()
+{
+	return "error code " + std::to_string(GetLastError());
+}
+
+#else
+
+const std::string AlgoLibraryLoader::LIB_EXTENSION(".so");
+
+/* RTLD_LOCAL - every algo has its own symbols, so two algos can export the same GetAlgorithm */
+AlgoLibHandle AlgoLibraryLoader::open(const std::string& libPath)
+{
+	return dlopen(libPath.c_str(), RTLD_NOW | RTLD_LOCAL);
+}
+
+void* AlgoLibraryLoader::getSymbol(AlgoLibHandle libHandle, const char* symbolName)
+{
+	return dlsym(libHandle, symbolName);
+}
+
+void AlgoLibraryLoader::close(AlgoLibHandle libHandle)
+{
+	dlclose(libHandle);
+}
+
+std::string AlgoLibraryLoader::lastError()
+{
+	auto err = dlerror();
+	return (err ? err : "unknown error");
+}
+
+#endif
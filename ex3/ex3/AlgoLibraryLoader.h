@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+typedef HINSTANCE AlgoLibHandle;
+#else
+typedef void* AlgoLibHandle;
+#endif
+
+/**
+ * \brief thin portable layer over the dynamic loader - LoadLibrary/GetProcAddress/FreeLibrary on windows, dlopen/dlsym/dlclose on linux
+ */
+class AlgoLibraryLoader
+{
+public:
+
+	static const std::string LIB_EXTENSION;													/* ".dll" on windows, ".so" on linux */
+
+	/* loads the library in libPath, returns nullptr if failed */
+	static AlgoLibHandle open(const std::string& libPath);
+
+	/* returns the address of the exported symbol, or nullptr if the library does not export it */
+	static void* getSymbol(AlgoLibHandle libHandle, const char* symbolName);
+
+	static void close(AlgoLibHandle libHandle);
+
+	/* description of the last loader error in this thread (for the log) */
+	static std::string lastError();
+
+private:
+	AlgoLibraryLoader() = delete;
+};
@@ -1,44 +1,46 @@
 #include "BattleshipBoard.h"
 #include <iostream>
-#include <fstream>
-#include <iterator>
 #include "BattleshipGameUtils.h"
 #include <algorithm>
+#include <climits>
+#include <cctype>
+#include "MappedFile.h"
 
-BattleshipBoard::BattleshipBoard(std::vector<char> board, int inputRows, int inputCols, int inputDepth) : boardVec(board), rows(inputRows), cols(inputCols), depth(inputDepth), isSuccCreated(true) {}
+BattleshipBoard::BattleshipBoard(std::vector<char> board, int inputRows, int inputCols, int inputDepth) : boardVec(std::move(board)), rows(inputRows), cols(inputCols), depth(inputDepth), isSuccCreated(true) {}
 
 BattleshipBoard::BattleshipBoard(const std::string & boardPath) : isSuccCreated(false)
 {
 	if (boardPath.empty()) return;
 
-	std::string line;
+	MappedFile boardFile(boardPath);
+	if (!boardFile.isOpen()) return;				/* we can't open the board file */
 
-	std::ifstream boardFile(boardPath.c_str());
-	if (boardFile.is_open())
-	{
-		/* parsing the first line to get the board dimensions */
-		std::getline(boardFile, line);
+	/* the file is scanned in place - every line is a range [lineBegin, lineEnd) in the mapped file, as std::getline would read it */
+	const char* filePos = boardFile.data();
+	const char* fileEnd = filePos + boardFile.size();
+	const char* lineBegin = filePos;
+	const char* lineEnd = filePos;
+
+	/* parsing the first line to get the board dimensions */
+	BattleshipGameUtils::getNextLine(filePos, fileEnd, lineBegin, lineEnd);
+
+	if (!parseBoardDimensions(lineBegin, lineEnd)) return;
+	boardVec = std::move(InitNewEmptyBoardVector(rows, cols, depth));
 
-		if (!parseBoardDimensions(line)) return;
-		boardVec = std::move(InitNewEmptyBoardVector(rows, cols, depth));
+	/* now parse the board - seperate matrix for every depth */
+	for (int d = 0; d < depth; d++)
+	{
+		while (!BattleshipGameUtils::emptyLine(lineBegin, lineEnd) && BattleshipGameUtils::getNextLine(filePos, fileEnd, lineBegin, lineEnd));
+		/* skip intermediate line between every matrix, and skip redundant lines */
 
-		/* now parse the board - seperate matrix for every depth */
-		for (int d = 0; d < depth; d++)
+		int currRow = 0;
+		while (currRow < rows && BattleshipGameUtils::getNextLine(filePos, fileEnd, lineBegin, lineEnd) && !BattleshipGameUtils::emptyLine(lineBegin, lineEnd))
 		{
-			while (!BattleshipGameUtils::emptyLine(line) && std::getline(boardFile, line));
-			/* skip intermediate line between every matrix, and skip redundant lines */
-
-			int currRow = 0;
-			while (currRow < rows && std::getline(boardFile, line) && !BattleshipGameUtils::emptyLine(line))
-			{
-				/* while we read < rows lines and we don't reach to eof in board file and line is not empty (end of current matrix) */
-				CopyInputLineToBoard(line, d, currRow);
-				currRow++;
-			}
+			/* while we read < rows lines and we don't reach to eof in board file and line is not empty (end of current matrix) */
+			CopyInputLineToBoard(lineBegin, lineEnd, d, currRow);
+			currRow++;
 		}
-		boardFile.close();
 	}
-	else return;				/* we can't open the board file */
 	isSuccCreated = true;
 }
 
@@ -65,39 +67,16 @@ BattleshipBoard & BattleshipBoard::operator=(BattleshipBoard && otherBoard) noex
 	return *this;
 }
 
-
-/* for battleship pixel in the board, we will check if the adjacent pixels of this pixel (up, down, left and right)
-is a different ship - if so, we have an adjacent error in board.
-*/
-bool BattleshipBoard::CheckIfHasAdjacentShips() const
+int BattleshipBoard::shipTypeIndex(char ch)
 {
-	char currPos;
-
-	for (int i = 0; i < rows; i++)
+	switch (toupper(ch))
 	{
-		for (int j = 0; j < cols; j++)
-		{
-			for (int k = 0; k < depth; k++)
-			{
-				currPos = (*this)(i, j, k);
-
-				if (currPos == BLANK_CHAR) continue;			/* if current position is not a ship - it is a ' ', because we clean the board at the begining */
-
-				auto nearbyCoordSet = getNearbyCoordinates({ i,j,k });
-
-				for (auto adjacentCoor : nearbyCoordSet)		/* for each nearby coordinate we check if we have adjacent ship (surronding other char)  */
-				{
-					char adjacentVal = (*this)(adjacentCoor.row, adjacentCoor.col, adjacentCoor.depth);
-
-					if (IsShipCharInBoard(adjacentVal) && adjacentVal != currPos)
-					{
-						return true;
-					}
-				}
-			}
-		}
+	case RUBBER_BOAT: return 0;
+	case ROCKET_SHIP: return 1;
+	case SUBMARINE: return 2;
+	case DESTROYER: return 3;
+	default: return -1;
 	}
-	return false;
 }
 
 bool BattleshipBoard::IsShipCharInBoard(char ch)
@@ -106,79 +85,63 @@ bool BattleshipBoard::IsShipCharInBoard(char ch)
 	return (ch == RUBBER_BOAT || ch == ROCKET_SHIP || ch == SUBMARINE || ch == DESTROYER);
 }
 
-std::set<std::pair<char, std::set<Coordinate>>> BattleshipBoard::ExtractShipsDetails() const
+std::vector<ShipDetails> BattleshipBoard::ExtractShipsDetails() const
 {
-	auto boardVecCopy = boardVec;				/* takes a copy of the boardVec, because we want to edit and delete found ships */
-	std::set<std::pair<char, std::set<Coordinate>>> setOfShipsDetails;
-	char currShipChar;
+	std::vector<ShipDetails> shipsDetails;
+	std::vector<bool> visitedCells(boardVec.size(), false);
+	std::vector<int> cellsStack;																	/* shared by all the ships, to allocate it only once */
 
-	for (int i = 0; i < rows; i++)
+	for (int cellIndex = 0; cellIndex < static_cast<int>(boardVec.size()); cellIndex++)
 	{
-		for (int j = 0; j < cols; j++)
-		{
-			for (int k = 0; k < depth; k++)
-			{
-				int currIndex = BattleshipGameUtils::calcCoordIndex(i, j, k, rows, cols);
+		if (boardVec[cellIndex] == BLANK_CHAR || visitedCells[cellIndex]) continue;
+		shipsDetails.push_back(extractShipFromCell(cellIndex, visitedCells, cellsStack));
+	}
 
-				if ((currShipChar = boardVecCopy.at(currIndex)) == ' ') continue;
+	return shipsDetails;
+}
 
-				std::set<Coordinate> coordOfCurrentShip;
+ShipDetails BattleshipBoard::extractShipFromCell(int cellIndex, std::vector<bool>& visitedCells, std::vector<int>& cellsStack) const
+{
+	static const auto sixDirections = BattleshipGameUtils::setSixOptionsVector();					/* a ship continues only up/down, left/right or in depth */
+	ShipDetails ship(boardVec[cellIndex], cellIndex, BattleshipGameUtils::calcCoordFromIndex(cellIndex, rows, cols));
+	visitedCells[cellIndex] = true;
+	cellsStack.assign(1, cellIndex);
 
-				getAllCurrShipCoords(boardVecCopy, i, j, k, currShipChar, coordOfCurrentShip, rows, cols, depth);
+	while (!cellsStack.empty())
+	{
+		auto currCoord = BattleshipGameUtils::calcCoordFromIndex(cellsStack.back(), rows, cols);
+		cellsStack.pop_back();
+
+		for (auto& nearbyCoord : sixDirections)
+		{
+			Coordinate nextCoord(currCoord.row + nearbyCoord.row, currCoord.col + nearbyCoord.col, currCoord.depth + nearbyCoord.depth);
+			if (!isCoordianteInBoard(nextCoord.row, nextCoord.col, nextCoord.depth)) continue;
 
-				setOfShipsDetails.insert(std::make_pair(currShipChar, coordOfCurrentShip));				/* insert to the big set current ship details - <'m', {<1,2>,<1,3>}>*/
+			int nextIndex = BattleshipGameUtils::calcCoordIndex(nextCoord.row, nextCoord.col, nextCoord.depth, rows, cols);
+			if (visitedCells[nextIndex] || boardVec[nextIndex] != ship.symbol) continue;
 
-				for (auto coord : coordOfCurrentShip)
-				{
-					currIndex = BattleshipGameUtils::calcCoordIndex(coord.row, coord.col, coord.depth, rows, cols);
-					boardVecCopy.at(currIndex) = ' ';													/* clear the board from this ship (we should have a copy of the board) */
-				}
-				coordOfCurrentShip.clear();
-			}
+			visitedCells[nextIndex] = true;
+			cellsStack.push_back(nextIndex);
+			ship.cellsIndices.push_back(nextIndex);
+			ship.minCoord = Coordinate(std::min(ship.minCoord.row, nextCoord.row), std::min(ship.minCoord.col, nextCoord.col), std::min(ship.minCoord.depth, nextCoord.depth));
+			ship.maxCoord = Coordinate(std::max(ship.maxCoord.row, nextCoord.row), std::max(ship.maxCoord.col, nextCoord.col), std::max(ship.maxCoord.depth, nextCoord.depth));
 		}
 	}
-
-	return std::set<std::pair<char, std::set<Coordinate>>>(setOfShipsDetails);
+	return ship;
 }
 
-void BattleshipBoard::ExtractShipsDetailsOfGamePlayers(std::set<std::pair<char, std::set<Coordinate>>>& shipDetailsA, std::set<std::pair<char, std::set<Coordinate>>>& shipDetailsB)const
+void BattleshipBoard::ExtractShipsDetailsOfGamePlayers(std::vector<ShipDetails>& shipDetailsA, std::vector<ShipDetails>& shipDetailsB)const
 {
-	auto allShipDeatils = ExtractShipsDetails();
-
-	for (auto shipDetail : allShipDeatils)
+	for (auto& shipDetail : ExtractShipsDetails())
 	{
-		if (isPlayerShip(PLAYERID_A, shipDetail.first))
-			shipDetailsA.insert(shipDetail);
+		if (isPlayerShip(PLAYERID_A, shipDetail.symbol))
+			shipDetailsA.push_back(std::move(shipDetail));
 		else 
-			shipDetailsB.insert(shipDetail);
+			shipDetailsB.push_back(std::move(shipDetail));
 	}
 
 }
 
-void BattleshipBoard::getAllCurrShipCoords(std::vector<char> board, int r, int c, int d, char currShipChar, std::set<Coordinate>& coordOfCurrentShip, int boardRows, int boardCols, int boardDepth)
-{
-	
-	int CoordIndex = BattleshipGameUtils::calcCoordIndex(r, c, d, boardRows, boardCols);
-	if (currShipChar == board.at(CoordIndex))
-	{
-		board.at(CoordIndex) = BLANK_CHAR;												/* clear the current position and add it to the coordinates set*/
-		coordOfCurrentShip.insert({ r, c, d });
-
-		if (BattleshipGameUtils::isCoordianteInBoard(r, c + 1, d, boardRows, boardCols, boardDepth))
-			getAllCurrShipCoords(board, r, c + 1, d, currShipChar, coordOfCurrentShip, boardCols, boardRows, boardDepth);
-		if (BattleshipGameUtils::isCoordianteInBoard(r, c - 1, d, boardCols, boardRows, boardDepth))
-			getAllCurrShipCoords(board, r, c - 1, d, currShipChar, coordOfCurrentShip, boardCols, boardRows, boardDepth);
-		if (BattleshipGameUtils::isCoordianteInBoard(r + 1, c, d, boardCols, boardRows, boardDepth))
-			getAllCurrShipCoords(board, r + 1, c, d, currShipChar, coordOfCurrentShip, boardCols, boardRows, boardDepth);
-		if (BattleshipGameUtils::isCoordianteInBoard(r - 1, c, d, boardCols, boardRows, boardDepth))
-			getAllCurrShipCoords(board, r - 1, c, d, currShipChar, coordOfCurrentShip, boardCols, boardRows, boardDepth);
-		if (BattleshipGameUtils::isCoordianteInBoard(r, c, d + 1, boardCols, boardRows, boardDepth))
-			getAllCurrShipCoords(board, r, c, d + 1, currShipChar, coordOfCurrentShip, boardCols, boardRows, boardDepth);
-		if (BattleshipGameUtils::isCoordianteInBoard(r, c, d - 1, boardCols, boardRows, boardDepth))
-			getAllCurrShipCoords(board, r, c, d - 1, currShipChar, coordOfCurrentShip, boardCols, boardRows, boardDepth);
-	}
-}
-
 
 std::set<Coordinate> BattleshipBoard::getNearbyCoordinates(Coordinate coord) const
 /* we check in this function every coordinate seperatly */
@@ -231,58 +194,82 @@ void BattleshipBoard::setCoord(int r, int c, int d, char ch)
 /* this is strange to return reference to a vector, so we will return by value, and then we will make move to prevent new allocation */
 std::vector<char> BattleshipBoard::InitNewEmptyBoardVector(int rows, int cols, int depths)
 {
-	std::vector<char> vec(rows * cols * depths, BLANK_CHAR);
+	std::vector<char> vec(rows * cols * depths, char(BLANK_CHAR));		/* by value - the in-class constant has no out-of-class definition */
 	return vec;
 }
 
 
-void BattleshipBoard::CopyInputLineToBoard(const std::string & line, int currDepth, int currRow)
+void BattleshipBoard::CopyInputLineToBoard(const char* lineBegin, const char* lineEnd, int currDepth, int currRow)
 {
-	size_t lineLen;
-	if (line.length() < unsigned(cols))
-		lineLen = line.length();
-	else
-		lineLen = cols;
+	auto lineLen = std::min<ptrdiff_t>(lineEnd - lineBegin, cols);
+	const auto& charsTable = boardCharsTable();
 
-	for (auto j = 0; j < lineLen; j++)
-	{
-		if (IsShipCharInBoard(line[j])) {
-			setCoord(currRow, j, currDepth, line[j]);	/*else it will remain ' ' */
-		}
-	}
+	/* the row is continuous in boardVec, so the whole line is copied at once (else the position will remain ' ') */
+	std::transform(lineBegin, lineBegin + lineLen, boardVec.begin() + BattleshipGameUtils::calcCoordIndex(currRow, 0, currDepth, rows, cols),
+		[&charsTable](char ch) { return charsTable[static_cast<unsigned char>(ch)]; });
 }
 
-bool BattleshipBoard::parseBoardDimensions(std::string& line)
+const std::array<char, 256>& BattleshipBoard::boardCharsTable()
 {
-	std::transform(line.begin(), line.end(), line.begin(), ::tolower);  //to support 'x' and 'X'
-	
-	std::vector<int> dimsVec;
-	std::vector<std::string> tokens;
-	char* stringEnd = nullptr;
+	static const std::array<char, 256> charsTable = []()
+	{
+		std::array<char, 256> table;
+		for (int ch = 0; ch < 256; ch++)
+			table[ch] = IsShipCharInBoard(static_cast<char>(ch)) ? static_cast<char>(ch) : char(BLANK_CHAR);
+		return table;
+	}();
+	return charsTable;
+}
 
-	BattleshipGameUtils::splitStringByToken(line, BOARD_DIM_DELIMITER, std::back_inserter(tokens));
+bool BattleshipBoard::parseBoardDimensions(const char* lineBegin, const char* lineEnd)
+{
+	int dims[3];
+	int dimsNum = 0;
 
-	for (auto tok : tokens)
+	/* the tokens are seperated by 'x' or 'X'. like splitting with std::getline, a delimiter at the end of the line does not start a new token */
+	auto tokenBegin = lineBegin;
+	while (tokenBegin != lineEnd)
 	{
-		int num = strtol(tok.c_str(), &stringEnd, 10);
-		
-		if (num < 1 || *stringEnd) return false;
+		auto tokenEnd = std::find_if(tokenBegin, lineEnd, [](char ch) { return tolower(ch) == BOARD_DIM_DELIMITER; });
+		int num;
+
+		if (!parseBoardDimension(tokenBegin, tokenEnd, num)) return false;
 
-		dimsVec.push_back(num);
+		if (dimsNum < 3) dims[dimsNum] = num;
+		dimsNum++;
+		tokenBegin = (tokenEnd == lineEnd ? lineEnd : tokenEnd + 1);
 	}
 
-	if (dimsVec.size() < 3) return false;
+	if (dimsNum < 3) return false;
 
-	cols = dimsVec[0];
-	rows = dimsVec[1];
-	depth = dimsVec[2];
+	cols = dims[0];
+	rows = dims[1];
+	depth = dims[2];
 
 	return true;
 
 }
 
+bool BattleshipBoard::parseBoardDimension(const char* tokenBegin, const char* tokenEnd, int& dimension)
+{
+	while (tokenBegin != tokenEnd && isspace(static_cast<unsigned char>(*tokenBegin))) tokenBegin++;		/* strtol skips leading white spaces */
+	if (tokenBegin != tokenEnd && *tokenBegin == '+') tokenBegin++;
+	if (tokenBegin == tokenEnd) return false;
+
+	long long num = 0;
+	for (; tokenBegin != tokenEnd; tokenBegin++)
+	{
+		if (!isdigit(static_cast<unsigned char>(*tokenBegin))) return false;
+		num = num * 10 + (*tokenBegin - '0');
+		if (num > INT_MAX) return false;
+	}
+
+	dimension = static_cast<int>(num);
+	return dimension >= 1;
+}
+
 
-void BattleshipBoard::countShipsTypes(const std::set<std::pair<char, std::set<Coordinate>>>& allShipsDetails, std::vector<std::pair<int, int>>& shipsCountVec) {
+void BattleshipBoard::countShipsTypes(const std::vector<ShipDetails>& allShipsDetails, std::vector<std::pair<int, int>>& shipsCountVec) {
 
 	int count_b = 0;//lenght = 1
 	int count_p = 0;//lenght = 2
@@ -291,7 +278,7 @@ void BattleshipBoard::countShipsTypes(const std::set<std::pair<char, std::set<Co
 
 	for (auto shipType : allShipsDetails) {
 
-		char ch = tolower(shipType.first);
+		char ch = tolower(shipType.symbol);
 
 		if (ch == tolower(RUBBER_BOAT)) count_b++;
 		if (ch == tolower(SUBMARINE)) count_m++;
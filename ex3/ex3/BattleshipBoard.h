@@ -2,8 +2,27 @@
 #include <set>
 #include "IBattleshipGameAlgo.h"
 #include <vector>
+#include <array>
 #include "BattleshipGameUtils.h"
 
+/**
+ * \brief a ship found in the board - a connected component of cells with the same ship char
+ */
+struct ShipDetails
+{
+	char symbol;
+	std::vector<int> cellsIndices;													/* indices of the ship cells in the board vector (see BattleshipGameUtils::calcCoordIndex) */
+	Coordinate minCoord;															/* bounding box of the ship (0-based, inclusive) */
+	Coordinate maxCoord;
+
+	ShipDetails(char shipSymbol, int firstCellIndex, Coordinate firstCellCoord) : symbol(shipSymbol), cellsIndices(1, firstCellIndex), minCoord(firstCellCoord), maxCoord(firstCellCoord) {}
+
+	/* number of cells of the bounding box in the dimension */
+	int rowsLen() const { return maxCoord.row - minCoord.row + 1; }
+	int colsLen() const { return maxCoord.col - minCoord.col + 1; }
+	int depthLen() const { return maxCoord.depth - minCoord.depth + 1; }
+};
+
 class BattleshipBoard
 {
 public:
@@ -26,13 +45,9 @@ public:
 
 	bool isSuccessfullyCreated() const { return (rows > 0 && cols > 0 && depth > 0 && !boardVec.empty() && isSuccCreated); }
 
-	/* given a player's board,
-	returns set of pairs, which contains for each ship it's coordinates:
-	for example: {<'m', {<1,2,1>,<1,3,1>}> , <'P', {<8,5,4> , <8,6,4> , <8,7,4>}> } */
-	std::set<std::pair<char, std::set<Coordinate>>> ExtractShipsDetails()const;
-
-	/* given a boardVec and specific coordintets and ship char, inserts to the set coordOfCurrentShip all coordinates of this current ship (recursive function) */
-	static void getAllCurrShipCoords(std::vector<char> board, int r, int c, int d, char currShipChar, std::set<Coordinate>& coordOfCurrentShip, int boardRows, int boardCols, int boardDepth);
+	/* given a player's board, returns the ships table of the board - for every ship its char, its cells and its bounding box.
+	the ships are found in a single pass over the board, in the order of their first cell in the board vector */
+	std::vector<ShipDetails> ExtractShipsDetails()const;
 
 	/* checks if given coordinate is a valid location in board*/
 	bool isCoordianteInBoard(int r, int c, int d)const { return BattleshipGameUtils::isCoordianteInBoard(r, c, d, rows, cols, depth); };
@@ -50,19 +65,22 @@ public:
 	void setCoord(int r, int c, int d, char ch);	
 
 	/* given set of shipsDetails, counts each ship type and update shipsCountsVec respectively */
-	static void countShipsTypes(const std::set<std::pair<char, std::set<Coordinate>>>& allShipsDetails, std::vector<std::pair<int, int>>& shipsCountVec);
+	static void countShipsTypes(const std::vector<ShipDetails>& allShipsDetails, std::vector<std::pair<int, int>>& shipsCountVec);
 	
-	/* checks if the matrix conatins adjacent ships, if so - prints relevant message to the log */
-	bool CheckIfHasAdjacentShips() const;	
+	/* index of the ship type of the given char (0 - 3, the same for both players), or -1 if it is not a ship char */
+	static int shipTypeIndex(char ch);
 	
 
-	/* given game mainBoard, update the two input sets with the ships details belongs to each player */
-	void ExtractShipsDetailsOfGamePlayers(std::set<std::pair<char, std::set<Coordinate>>>& detailsPlayerA, std::set<std::pair<char, std::set<Coordinate>>>& detailsPlayerB)const;
+	/* given game mainBoard, update the two input vectors with the ships details belongs to each player */
+	void ExtractShipsDetailsOfGamePlayers(std::vector<ShipDetails>& detailsPlayerA, std::vector<ShipDetails>& detailsPlayerB)const;
 
 	static const char BLANK_CHAR = ' ';
 
 private:
 
+	friend class BoardBitPlanes;															/* builds its planes from the board vector */
+	friend class BoardValidator;															/* walks the board vector */
+
 	static const int PLAYERID_A = 0;
 	static const int PLAYERID_B = 1;
 	static const char RUBBER_BOAT = 'B';
@@ -80,13 +98,22 @@ private:
 	/* init Board vector with ' ' */
 	static std::vector<char> InitNewEmptyBoardVector(int rows, int cols, int depths);					
 
-	/* given a input line string, copies this line to the board */
-	void CopyInputLineToBoard(const std::string& line, int currDepth, int currRow);	
+	/* given a input line [lineBegin, lineEnd), copies this line to the board row (at most cols chars, chars that are not ships are copied as BLANK_CHAR) */
+	void CopyInputLineToBoard(const char* lineBegin, const char* lineEnd, int currDepth, int currRow);
+
+	/* parse first row of board file - the dimensions row (<cols>x<rows>x<depth>) */
+	bool parseBoardDimensions(const char* lineBegin, const char* lineEnd);
 
-	/* parse first row of board file - the dimensions row */
-	bool parseBoardDimensions(std::string& line);		
+	/* parse single dimension of the dimensions row - a positive integer, as strtol would parse it, with no other chars */
+	static bool parseBoardDimension(const char* tokenBegin, const char* tokenEnd, int& dimension);
+
+	/* for every char - the char itself if it is a ship char, otherwise BLANK_CHAR */
+	static const std::array<char, 256>& boardCharsTable();
 	
 	/* given a ship char, checks if it represents valid ship char in board */
 	static bool IsShipCharInBoard(char ch);
 
+	/* finds the ship of the given (not visited) cell with an iterative flood fill, and marks its cells as visited. cellsStack is only a work buffer */
+	ShipDetails extractShipFromCell(int cellIndex, std::vector<bool>& visitedCells, std::vector<int>& cellsStack) const;
+
 };
@@ -7,6 +7,7 @@
 #include "PlayerGameResultData.h"
 #include <memory>
 #include "BoardDataImpl.h"
+#include "BoardGameTemplate.h"
 
 
 typedef IBattleshipGameAlgo *(*GetAlgoFuncType)();
@@ -24,7 +25,10 @@ public:
 	BattleshipGameManager() = delete;														/* deletes empty constructor */
 
 	
-	BattleshipGameManager(const BattleshipBoard& board, std::unique_ptr<IBattleshipGameAlgo> algoA, std::unique_ptr<IBattleshipGameAlgo> algoB);
+	/* the caller owns the algos instances - they are not deleted by the game, so the same instances can be reused in the next games.
+	 * the board template is shared with the other games on this board - the game only creates the ships state of the players from it.
+	 * the ships state is allocated from gameArena (if given), which must not be reset before the game is destroyed */
+	BattleshipGameManager(const BoardGameTemplate& boardTemplate, IBattleshipGameAlgo* algoA, IBattleshipGameAlgo* algoB, MonotonicArena* gameArena = nullptr);
 	~BattleshipGameManager() = default;
 
 	BattleshipGameManager(const BattleshipGameManager& otherGame) = delete;					/* deletes copy constructor */
@@ -32,13 +36,21 @@ public:
 	
 	PlayerGameResultData Run();																/* given a game object, run's the game and outputs the results */
 
+	/* same as Run(), when the concrete types of algoA and algoB are known at compile time (built-in algos).
+	 * the algos calls are made through the concrete types, so the compiler can inline them instead of calling through the vtable */
+	template <typename AlgoA, typename AlgoB>
+	PlayerGameResultData Run();
+
+	/* number of attacks the given player made in this game */
+	int getMovesCount(int playerId) const { return (playerId == PLAYERID_A ? playerA.movesCount : playerB.movesCount); }
+
 private:
 
-	const BattleshipBoard& mainBoard;
+	const BoardGameTemplate& gameBoardTemplate;
 	GamePlayerData playerA;																	/* an object that keeps all relevant data of playerA in the game */
 	GamePlayerData playerB;																	/* an object that keeps all relevant data of playerB in the game */
-	std::unique_ptr<IBattleshipGameAlgo> algorithmA;										/* unique ptr for this algoA instance. will deleted in destructor of this class */
-	std::unique_ptr<IBattleshipGameAlgo> algorithmB;										/* unique ptr for this algoB instance. will deleted in destructor of this class */
+	IBattleshipGameAlgo* algorithmA;														/* algoA instance for this game. owned by the caller */
+	IBattleshipGameAlgo* algorithmB;														/* algoB instance for this game. owned by the caller */
 	
 
 	static const char A = 'A';																/* player char for player A - for printing */
@@ -52,11 +64,98 @@ private:
 	the function wich invokes Run, will update the player's name to be PlayersA name
 	*/
 	static PlayerGameResultData outputGameResult(GamePlayerData* currPlayer, GamePlayerData* otherPlayer);
+
+	/* asks the algo of currPlayer for its next valid attack, through its concrete type */
+	template <typename AlgoA, typename AlgoB>
+	static Coordinate getNextAttack(const GamePlayerData* currPlayer);
+
+	/* notifies both algos on the attack result (every algo is notified about the attacks of both players) */
+	template <typename AlgoA, typename AlgoB>
+	void notifyAlgosOnAttackResult(int attackerId, Coordinate move, AttackResult result) const;
 	
 	
 	/**
-	 * \brief given playerId and player's boardData, call to algo setPlayer and setBoard. in addition, create the ships list and the shipsBoard of this player,
-	 *  given the set of his shipsDetails 
+	 * \brief given playerId, call to algo setPlayer and setBoard with the player's view of the board. in addition, create the shipsBoard of this player
+	 *  from his ships template, and init playerData with them
 	 */
-	void initPlayerData(int playerId, IBattleshipGameAlgo* playerAlgo, std::set<std::pair<char,  std::set<Coordinate>>>& shipsDetails, ShipsBoard& playerShipBoard, const BoardDataImpl& playerBoardData)const;
+	void initPlayerData(int playerId, IBattleshipGameAlgo* playerAlgo, GamePlayerData& playerData, MonotonicArena* gameArena)const;
 };
+
+
+template <typename AlgoA, typename AlgoB>
+Coordinate BattleshipGameManager::getNextAttack(const GamePlayerData* currPlayer)
+{
+	if (currPlayer->id == PLAYERID_A)
+		return currPlayer->getAlgoNextAttack<AlgoA>();
+	return currPlayer->getAlgoNextAttack<AlgoB>();
+}
+
+template <typename AlgoA, typename AlgoB>
+void BattleshipGameManager::notifyAlgosOnAttackResult(int attackerId, Coordinate move, AttackResult result) const
+{
+	static_cast<AlgoA*>(algorithmA)->notifyOnAttackResult(attackerId, move, result);
+	static_cast<AlgoB*>(algorithmB)->notifyOnAttackResult(attackerId, move, result);
+}
+
+template <typename AlgoA, typename AlgoB>
+PlayerGameResultData BattleshipGameManager::Run()
+{
+	Coordinate nextAttack(-1,-1,-1);
+	std::pair<AttackResult, int> attackRes;
+	GamePlayerData* currPlayer = &playerA;
+	GamePlayerData* otherPlayer = &playerB;
+
+	// as long as one of the players has more moves and no one won
+	while (currPlayer->hasMoreMoves || otherPlayer->hasMoreMoves) {
+
+		if (!currPlayer->hasMoreMoves) {
+			// if current player doesnt have anymore moves continue to next player
+			std::swap(currPlayer, otherPlayer);
+			continue;
+		}
+		nextAttack = getNextAttack<AlgoA, AlgoB>(currPlayer);
+		if (nextAttack.row == -1 && nextAttack.col == -1 && nextAttack.depth == -1) {
+			// current player finished
+			currPlayer->hasMoreMoves = false;
+			continue;
+		}
+		// if got here the attack coordinates are in the board 
+		currPlayer->movesCount++;
+
+		// attack other player 
+		attackRes = otherPlayer->realAttack(nextAttack);
+
+		if (attackRes.first == AttackResult::Miss) {
+			// the opponent doesnt have a ship in this coordinates; check if attacked myself
+			attackRes = currPlayer->realAttack(nextAttack);
+
+			if (attackRes.first != AttackResult::Miss) { // currPlayer attacked himself
+														 // the other player gets points
+				otherPlayer->incrementScore(attackRes.second);
+			}
+			notifyAlgosOnAttackResult<AlgoA, AlgoB>(currPlayer->id, nextAttack, attackRes.first);
+			// pass turn to other player- if missed || if attacked myself
+			std::swap(currPlayer, otherPlayer);
+			//check if someone won
+			if ((currPlayer->currShipsCount == 0) || (otherPlayer->currShipsCount == 0)) {
+				break;
+			}
+		}
+		else {
+			if (attackRes.second == -1) {	// hit opponents ship but not in a new coordinate; switch turns
+				std::swap(currPlayer, otherPlayer);
+			}
+			else {
+				currPlayer->incrementScore(attackRes.second);
+				notifyAlgosOnAttackResult<AlgoA, AlgoB>(currPlayer->id, nextAttack, attackRes.first);
+				// keep my turn 
+			}
+			//check if someone won
+			if ((currPlayer->currShipsCount == 0) || (otherPlayer->currShipsCount == 0)) { 
+				break;
+			}
+		}
+	}
+	return outputGameResult(currPlayer, otherPlayer);
+
+}
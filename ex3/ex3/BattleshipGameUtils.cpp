@@ -3,10 +3,23 @@
 #include <fstream>
 #include <sstream>
 #include <vector>
-#include <windows.h>
 #include <algorithm>
 #include <iostream>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstring>
 #include "IBattleshipGameAlgo.h"
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <climits>
+#include <cstdlib>
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
 
 using namespace std;
 
@@ -32,8 +45,13 @@ std::ostream& operator<<(std::ostream& out, const Coordinate& c) {
 
 bool BattleshipGameUtils::getFullPath(std::string & path)
 {
+#ifdef _WIN32
 	char fullPath[_MAX_PATH];
 	if (_fullpath(fullPath, path.c_str(), _MAX_PATH) == nullptr)
+#else
+	char fullPath[PATH_MAX];
+	if (realpath(path.c_str(), fullPath) == nullptr)
+#endif
 	{
 		std::cout << "Error: Invalid path -  can't get full path of: " << path << ". Exiting...";
 		return false;
@@ -44,6 +62,10 @@ bool BattleshipGameUtils::getFullPath(std::string & path)
 
 bool BattleshipGameUtils::isValidDir(const std::string& path)
 {
+#ifndef _WIN32
+	struct stat pathStat;
+	return (stat(path.c_str(), &pathStat) == 0 && S_ISDIR(pathStat.st_mode));
+#else
 	std::stringstream cdCommandString;
 	cdCommandString << "cd " << path << " 1> nul 2> nul" << std::endl;	/* trying to cd to the input directory */
 	auto commandRes = system(cdCommandString.str().c_str());
@@ -51,6 +73,7 @@ bool BattleshipGameUtils::isValidDir(const std::string& path)
 		return true;
 	else
 		return false;
+#endif
 }
 
 /* return true if str end with given suffix, else return false */
@@ -62,6 +85,21 @@ bool BattleshipGameUtils::isStringEndsWith(const std::string& str, const std::st
 std::vector<std::string> BattleshipGameUtils::SortedDirlistSpecificExtension(std::string const& dirPath, std::string const& ext)
 {
 	std::vector<std::string> outputFilenames;
+#ifndef _WIN32
+	auto dir = opendir(dirPath.c_str());
+	if (dir != nullptr)
+	{
+		struct dirent* entry;
+		while ((entry = readdir(dir)) != nullptr)
+		{
+			std::string currFileName = entry->d_name;
+			if (isStringEndsWith(currFileName, ext))
+				outputFilenames.push_back(currFileName);
+		}
+		std::sort(outputFilenames.begin(), outputFilenames.end());		/* readdir order depends on the file system too */
+		closedir(dir);
+	}
+#else
 	HANDLE dir;
 	WIN32_FIND_DATAA fileData; //data struct for file
 	std::string currFileName;
@@ -87,14 +125,75 @@ std::vector<std::string> BattleshipGameUtils::SortedDirlistSpecificExtension(std
 
 		FindClose(dir); /* Closes a file search handle opened by the FindFirstFile function */
 	}
+#endif
 
 	return outputFilenames;
 }
 
-bool BattleshipGameUtils::emptyLine(const std::string& str)
+void BattleshipGameUtils::parallelFor(size_t jobsNum, size_t threadsNum, const std::function<void(size_t)>& job)
+{
+	threadsNum = (threadsNum > jobsNum ? jobsNum : threadsNum);
+	if (threadsNum <= 1)																	/* no need for threads */
+	{
+		for (size_t i = 0; i < jobsNum; i++) job(i);
+		return;
+	}
+
+	std::atomic<size_t> nextJob(0);
+	auto threadJob = [&]() {
+		for (auto i = nextJob++; i < jobsNum; i = nextJob++) job(i);
+	};
+
+	std::vector<std::thread> threadsPool;
+	threadsPool.reserve(threadsNum - 1);
+	for (size_t t = 1; t < threadsNum; t++)
+		threadsPool.emplace_back(threadJob);
+	threadJob();																			/* the calling thread works too */
+
+	for (auto& t : threadsPool)
+		t.join();
+}
+
+bool BattleshipGameUtils::emptyLine(const char* lineBegin, const char* lineEnd)
 {
 	/* for parsing board from file */
-	return (str.empty() || str.compare("\r") == 0);
+	return (lineBegin == lineEnd || (lineEnd - lineBegin == 1 && *lineBegin == '\r'));
+}
+
+bool BattleshipGameUtils::getNextLine(const char*& filePos, const char* fileEnd, const char*& lineBegin, const char*& lineEnd)
+{
+	lineBegin = lineEnd = filePos;
+	if (filePos == fileEnd) return false;
+
+	auto newLine = static_cast<const char*>(memchr(filePos, '\n', fileEnd - filePos));
+	if (!newLine)																			/* last line, without '\n' */
+	{
+		lineEnd = filePos = fileEnd;
+		return true;
+	}
+
+	lineEnd = newLine;
+	if (lineEnd != lineBegin && *(lineEnd - 1) == '\r') lineEnd--;						/* same as reading the file in text mode on windows */
+	filePos = newLine + 1;
+	return true;
+}
+
+bool BattleshipGameUtils::hashFileContent(const std::string& filePath, uint64_t& fileHash, uint64_t& fileSize)
+{
+	MappedFile file(filePath);
+	if (!file.isOpen()) return false;
+
+	uint64_t hash = 14695981039346656037ULL;										/* FNV-1a offset basis */
+	auto data = file.data();
+	for (size_t i = 0; i < file.size(); i++)
+	{
+		hash ^= static_cast<unsigned char>(data[i]);
+		hash *= 1099511628211ULL;													/* FNV-1a prime */
+	}
+
+	fileHash = hash;
+	fileSize = file.size();
+	return true;
 }
 
 
@@ -155,3 +254,26 @@ void BattleshipGameUtils::mergeVector(std::vector<Coordinate>& allOptions, const
 }
 
 /*utils***************************************************************************************************************/
+
+int BattleshipGameUtils::popcount(uint64_t word)
+{
+#if defined(__GNUC__)
+	return __builtin_popcountll(word);
+#else
+	word = word - ((word >> 1) & 0x5555555555555555ULL);
+	word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+	word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return static_cast<int>((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+long long BattleshipGameUtils::steadyClockMicros()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::mt19937& BattleshipGameUtils::threadRandomEngine()
+{
+	thread_local std::mt19937 engine(std::random_device{}());
+	return engine;
+}
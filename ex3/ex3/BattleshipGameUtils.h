@@ -5,6 +5,10 @@
 #include <iterator>
 #include "IBattleshipGameAlgo.h"
 #include <set>
+#include <cstdlib>
+#include <functional>
+#include <cstdint>
+#include <random>
 
 
 class BattleshipGameUtils
@@ -16,11 +20,24 @@ public:
 	static bool isValidDir(const std::string& path);
 	static bool isStringEndsWith(const std::string& str, const std::string& suffix);
 	static std::vector<std::string> SortedDirlistSpecificExtension(std::string const& dirPath, std::string const& ext);
-	static bool emptyLine(const std::string& str);
-	static int calcCoordIndex(int r, int c, int d, int boardRows, int boardCols) { return r + c * boardCols + d * boardCols * boardRows; }
+	static bool emptyLine(const char* lineBegin, const char* lineEnd);
+
+	/* reads the next line of a file that is scanned in place (see MappedFile), like std::getline - [lineBegin, lineEnd) is the line without the '\n' (and without the '\r' of "\r\n").
+	 * returns false (with an empty line) if there are no more chars in the file */
+	static bool getNextLine(const char*& filePos, const char* fileEnd, const char*& lineBegin, const char*& lineEnd);
+
+	/* FNV-1a (64 bit) hash of the given file content, and the file size. returns false if the file can not be read */
+	static bool hashFileContent(const std::string& filePath, uint64_t& fileHash, uint64_t& fileSize);
+	static int calcCoordIndex(int r, int c, int d, int boardRows, int boardCols) { return c + r * boardCols + d * boardCols * boardRows; }		/* 0-based (r,c,d) -> index in a 1D board vector */
+	static Coordinate calcCoordFromIndex(int index, int boardRows, int boardCols) { return Coordinate((index / boardCols) % boardRows, index % boardCols, index / (boardCols * boardRows)); }	/* the inverse of calcCoordIndex */
 	static bool isCoordianteInBoard(int r, int c, int d, int rowsNum, int colsNum, int depthNum) { return (r >= 0 && r < rowsNum && c >= 0 && c < colsNum && d >= 0 && d < depthNum); }
-	template <typename I>
-	static I randomElement(I begin, I end);
+	static int randomIndex(int n);																/* a uniform random index in [0, n) with std::rand, @assume n > 0 */
+	static int popcount(uint64_t word);															/* number of set bits in the word */
+	static std::mt19937& threadRandomEngine();													/* a random engine of the calling thread (seeded once, from std::random_device) */
+	static long long steadyClockMicros();														/* std::chrono::steady_clock time, in microseconds - for deadlines */
+
+	/* runs job(i) for every i in [0, jobsNum) on up to threadsNum threads (every thread takes the next index atomically). returns after all jobs are done */
+	static void parallelFor(size_t jobsNum, size_t threadsNum, const std::function<void(size_t)>& job);
 
 
 	/* Functions for playerSmart */
@@ -51,19 +68,16 @@ void BattleshipGameUtils::splitStringByToken(const std::string & str, char delim
 	}
 }
 
-/* taken from http://stackoverflow.com/a/6943003  */
-template<typename I>
-inline I BattleshipGameUtils::randomElement(I begin, I end)
+/* taken from http://stackoverflow.com/a/6943003 (RAND_MAX + 1 is computed in 64 bits - with a 32 bit RAND_MAX it overflows an int) */
+inline int BattleshipGameUtils::randomIndex(int n)
 {
-	auto n = std::distance(begin, end);
-	auto divisor = (RAND_MAX + 1) / n;
+	auto divisor = (static_cast<long long>(RAND_MAX) + 1) / n;
 
-	auto k = n;
+	auto k = static_cast<long long>(n);
 
 	do { k = std::rand() / divisor; } while (k >= n);
 
-	std::advance(begin, k);
-	return begin;
+	return static_cast<int>(k);
 }
 
 /* Coordinate Utils */
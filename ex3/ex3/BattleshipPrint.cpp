@@ -2,6 +2,14 @@
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <thread>
+#include <chrono>
+#endif
 
 int BattleshipPrint::delay = printDefaultDealy;
 bool BattleshipPrint::printOneTable = deafultOneTable;
@@ -13,7 +21,7 @@ void BattleshipPrint::printStandingsTable(std::vector<PlayerGameResultData> play
 
 	if(printOneTable)												/* we are in one table mode - we will each round table in the same place after delay time for each rpund table */
 	{
-		currRound == 1 ? Sleep(FIRST_SCREEN_DELAY) : Sleep(delay);			/* we want to wait more time after the first screen with the number of valid algos and boards */
+		currRound == 1 ? sleepMilliseconds(FIRST_SCREEN_DELAY) : sleepMilliseconds(delay);			/* we want to wait more time after the first screen with the number of valid algos and boards */
 		clearScreen();
 	}
 
@@ -28,7 +36,7 @@ void BattleshipPrint::printStandingsTable(std::vector<PlayerGameResultData> play
 
 	int placeNum = 1;
 
-	auto nameWidth = max(PlayerGameResultData::getMaxPlayerNameWidth(playersStandingsVec) + 4, strlen("Team Name") + 4);
+	auto nameWidth = (std::max)(PlayerGameResultData::getMaxPlayerNameWidth(playersStandingsVec) + 4, strlen("Team Name") + 4);
 	
 	/* Table headers */
 	setColor(BLUE_COLOR);
@@ -71,7 +79,41 @@ void BattleshipPrint::printStandingsTable(std::vector<PlayerGameResultData> play
 	setColor(WHITE_COLOR);
 }
 
-void BattleshipPrint::setColor(WORD color)
+#ifdef _WIN32
+
+void BattleshipPrint::setColor(int color)
+{
+	SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), static_cast<WORD>(color));
+}
+
+void BattleshipPrint::clearScreen()
 {
-	SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), color);
+	system("cls");
 }
+
+void BattleshipPrint::sleepMilliseconds(int milliseconds)
+{
+	Sleep(milliseconds);
+}
+
+#else
+
+/* on linux we use the ANSI escape codes of the terminal instead of the console attributes */
+void BattleshipPrint::setColor(int color)
+{
+	if (color == RED_COLOR) std::cout << "\033[91m";
+	else if (color == BLUE_COLOR) std::cout << "\033[94m";
+	else std::cout << "\033[0m";
+}
+
+void BattleshipPrint::clearScreen()
+{
+	std::cout << "\033[2J\033[H";
+}
+
+void BattleshipPrint::sleepMilliseconds(int milliseconds)
+{
+	std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+}
+
+#endif
@@ -1,7 +1,6 @@
 #pragma once
 
 #include "BattleshipBoard.h"
-#include <windows.h>
 #include "PlayerGameResultData.h"
 
 class BattleshipPrint
@@ -33,8 +32,9 @@ public:
 	
 private:
 	BattleshipPrint() = delete;
-	static void setColor(WORD color);
-	static void clearScreen() { system("cls"); }
+	static void setColor(int color);
+	static void clearScreen();
+	static void sleepMilliseconds(int milliseconds);
 	
 	static int delay;
 	static bool printOneTable;
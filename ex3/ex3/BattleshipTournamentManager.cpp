@@ -4,14 +4,18 @@
 #include <condition_variable>
 #include <atomic>
 #include "BattleshipPrint.h"
+#include "CompiledBoard.h"
 #include <thread>
 #include <fstream>
 #include <string>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
 
  const std::string BattleshipTournamentManager::LOG_FILENAME("game.log");
 
 
-BattleshipTournamentManager::BattleshipTournamentManager(int argc, char * argv[]) : maxGamesThreads(UNINITIALIZED_ARG), successfullyCreated(true), TOURNAMENT_MIN_PLAYERS(UNINITIALIZED_ARG)
+BattleshipTournamentManager::BattleshipTournamentManager(int argc, char * argv[]) : maxGamesThreads(UNINITIALIZED_ARG), successfullyCreated(true), nextGameIndex(0), roundsNum(0), isRoundsNumFinal(true), isScheduleDone(true), TOURNAMENT_MIN_PLAYERS(UNINITIALIZED_ARG)
 {
 
 	if (!checkTournamentArguments(argc, argv)) {					/* checks arguments validity, and parse all arguments from program input and config file */
@@ -19,10 +23,21 @@ BattleshipTournamentManager::BattleshipTournamentManager(int argc, char * argv[]
 		return;
 	}
 	
-	Logger::Init(inputDirPath + "/" + LOG_FILENAME, logLevelVal);
+	Logger::Init(inputDirPath + "/" + LOG_FILENAME, logLevelVal, asyncLogger);
 	printProgramValuesToLog();
 
-	if (!checkTournamentBoards())									/* checks all board in the input data, and update the board vectors with all valid boards */
+	if (writeEventLog && !eventLog.open(inputDirPath + "/" + EventLog::EVENTS_FILENAME))
+		Logger::append("Failed opening the events log: " + inputDirPath + "/" + EventLog::EVENTS_FILENAME, Warning);
+
+	if (useValidationCache)
+		validationCache.load(inputDirPath + "/" + BoardsValidationCache::CACHE_FILENAME);
+
+	if (streamingPipeline)
+	{
+		if (!listTournamentBoardsFiles())							/* the boards will be checked while the games are running, now we only need the files */
+			successfullyCreated = false;
+	}
+	else if (!checkTournamentBoards())								/* checks all board in the input data, and update the board vectors with all valid boards */
 		successfullyCreated = false;
 
 	if (!loadTournamentAlgos())										/* checks all players algorithms in the input data, and update the algos vectors with all valid algos */
@@ -34,24 +49,38 @@ BattleshipTournamentManager::BattleshipTournamentManager(int argc, char * argv[]
 	}								
 	Logger::append("Tournament successfully created !", Info);
 	std::cout << "Number of legal players: " << algosDetailsVec.size() << std::endl;
-	std::cout << "Number of legal boards: " << boardsVec.size() << std::endl << std::endl;
+	if (streamingPipeline)
+		std::cout << "Number of board files: " << boardsFilenames.size() << " (checked while the games are running)" << std::endl << std::endl;
+	else
+		std::cout << "Number of legal boards: " << boardsVec.size() << std::endl << std::endl;
 
-	createGamesPropertiesQueue();								/* creates all games propertioes for all possible games - each 2 players will play twice on each board - home and away*/
+	createGamesPropertiesSchedule();							/* creates all games propertioes for all possible games - each 2 players will play twice on each board - home and away*/
 
 	auto numOfplayers = algosDetailsVec.size();
-	auto numOfRounds = static_cast<int> (gamesPropertiesQueue.size() * 2 / numOfplayers);
+	auto roundsPerBoard = static_cast<int>(2 * (numOfplayers - 1));		/* every player plays twice against every other player on each board */
+
+	/* in streaming mode we don't know yet how many boards are valid, so the rounds data is allocated for all the board files,
+	 * and roundsNum is updated by every board that is added (the extra rounds are never used) */
+	auto maxNumOfRounds = static_cast<int>((streamingPipeline ? boardsFilenames.size() : boardsVec.size()) * roundsPerBoard);
+	roundsNum = (streamingPipeline ? 0 : maxNumOfRounds);
+	isRoundsNumFinal = isScheduleDone = !streamingPipeline;
 
-	Logger::append("Number of Games in the tournament:\t" + std::to_string(gamesPropertiesQueue.size()), Info);
-	Logger::append("Number of Rounds in the tournament:\t" + std::to_string(numOfRounds), Info);
+	if (streamingPipeline)
+		Logger::append("Maximum number of Games in the tournament:\t" + std::to_string(gamesPropertiesVec.capacity()), Info);
+	else
+		Logger::append("Number of Games in the tournament:\t" + std::to_string(gamesPropertiesVec.size()), Info);
+	Logger::append(std::string(streamingPipeline ? "Maximum number" : "Number") + " of Rounds in the tournament:\t" + std::to_string(maxNumOfRounds), Info);
 
-	allGamesResults.resize(numOfplayers);															/* allGamesResults dimensions are numOfPlayer X numOfRounds */
+	allGamesResults.resize(maxNumOfRounds);														/* allGamesResults dimensions are numOfRounds X numOfPlayer */
+	for (auto r = 0; r < maxNumOfRounds; r++) {
+		allGamesResults[r].resize(numOfplayers);													/* use resize to init with initial values for every game */
+	}
 	for (auto i = 0; i < numOfplayers; i++) { 
-		allGamesResults[i].resize(numOfRounds);														/* use resize to init with initial values for every game */
 		allRoundsCumulativeData.emplace_back(PlayerGameResultData(algosDetailsVec[i].playerName));
 	}
 
-	allRoundsData.reserve(numOfRounds);								/* use reserve beacuse of the atomic member of RoundData, we will init every value in the next loop */
-	for (auto i = 0; i < numOfRounds; i++) {
+	allRoundsData.reserve(maxNumOfRounds);							/* use reserve beacuse of the atomic member of RoundData, we will init every value in the next loop */
+	for (auto i = 0; i < maxNumOfRounds; i++) {
 		allRoundsData.emplace_back(numOfplayers, false);
 	}
 	playersProgress = std::vector<std::atomic<int>>(numOfplayers);
@@ -64,7 +93,7 @@ BattleshipTournamentManager::~BattleshipTournamentManager()
 	for (vitr = algosDetailsVec.begin(); vitr != algosDetailsVec.end(); ++vitr)
 	{
 		if (vitr->dllFileHandle)
-			FreeLibrary(vitr->dllFileHandle);										 /* close all the dynamic libs we opened */
+			AlgoLibraryLoader::close(vitr->dllFileHandle);							 /* close all the dynamic libs we opened */
 	}
 	Logger::Close();																/* close the logger */
 }
@@ -116,9 +145,22 @@ bool BattleshipTournamentManager::checkTournamentArguments(int argc, char * argv
 	return true;
 }
 
+bool BattleshipTournamentManager::listTournamentBoardsFiles()
+{
+	boardsFilenames = BattleshipGameUtils::SortedDirlistSpecificExtension(inputDirPath, ".sboard");
+
+	if (boardsFilenames.empty())
+	{
+		std::cout << "No board files (*.sboard) looking in path: " << inputDirPath.c_str() << std::endl;
+		Logger::append("No board files in dir, we will exit from the tournament after checking algos...", Error);
+		return false;
+	}
+	Logger::append("Number of board files: " + std::to_string(boardsFilenames.size()) + ". the boards will be checked while the games are running", Info);
+	return true;
+}
+
 bool BattleshipTournamentManager::checkTournamentBoards()
 {
-	std::string currBoardFullPath;
 	auto tmpFilenamesVector = BattleshipGameUtils::SortedDirlistSpecificExtension(inputDirPath, ".sboard");
 
 	if(tmpFilenamesVector.empty())
@@ -128,23 +170,26 @@ bool BattleshipTournamentManager::checkTournamentBoards()
 		return false;
 	}
 
-	for (auto currBoardFilename : tmpFilenamesVector)
-	{
-		currBoardFullPath = inputDirPath + "/" + currBoardFilename;
-		BattleshipBoard currBoard(currBoardFullPath);
+	/* every board is loaded and checked independently, so we do it in parallel.
+	 * every board has its own log entries, and we write them to the log afterwards by the files order (so boardsVec stays sorted too) */
+	std::vector<std::unique_ptr<BoardGameTemplate>> loadedBoards(tmpFilenamesVector.size());
+	std::vector<LogEntries> loadedBoardsLogs(tmpFilenamesVector.size());
 
-		Logger::append("Checking validity of board in: " + currBoardFullPath, Info);	
+	BattleshipGameUtils::parallelFor(tmpFilenamesVector.size(), maxGamesThreads, [&](size_t i) {
+		loadedBoards[i] = loadBoard(tmpFilenamesVector[i], loadedBoardsLogs[i]);
+	});
 
-		if (checkBoardValidity(currBoard))
-		{
-			boardsVec.push_back(std::move(currBoard));			/* take the board without create new board */
-			Logger::append("Board in: " + currBoardFullPath + " loaded succssefully", Info); 
-		}
-		else
+	boardsVec.reserve(tmpFilenamesVector.size());
+	for (size_t i = 0; i < tmpFilenamesVector.size(); i++)
+	{
+		Logger::append(loadedBoardsLogs[i]);
+		if (loadedBoards[i])
 		{
-			Logger::append("Board in: " + currBoardFullPath + " skipped, because of the errors above", Warning);
+			boardsVec.push_back(std::move(*loadedBoards[i]));
+			writeBoardAddedEvent(tmpFilenamesVector[i], static_cast<int>(boardsVec.size() - 1));
 		}
 	}
+	saveValidationCache();
 	Logger::append("Number of valid bords: " + std::to_string(boardsVec.size()), Info);
 
 	if (boardsVec.empty())
@@ -157,84 +202,191 @@ bool BattleshipTournamentManager::checkTournamentBoards()
 
 }
 
-bool BattleshipTournamentManager::checkBoardValidity(const BattleshipBoard& board)
+std::unique_ptr<BoardGameTemplate> BattleshipTournamentManager::loadBoard(const std::string& currBoardFilename, LogEntries& logEntries)
 {
-	if (!board.isSuccessfullyCreated()) {
-		Logger::append("failed Creating board", Warning);
-		return false;
+	auto currBoardFullPath = inputDirPath + "/" + currBoardFilename;
+	auto compiledBoardPath = CompiledBoard::getCompiledBoardPath(currBoardFullPath);
+	auto loadStartMicros = (eventLog.isOpen() ? eventLog.elapsedMicros() : 0);
+	std::vector<ShipDetails> shipsDetailsA, shipsDetailsB;
+
+	BattleshipBoard compiledBoard;
+	uint64_t contentHash, contentSize;
+	if (CompiledBoard::load(compiledBoardPath, currBoardFullPath, compiledBoard, shipsDetailsA, shipsDetailsB, contentHash, contentSize))
+	{
+		/* the compiled board is up to date, so it was already validated - no need to parse and check the .sboard again (but its validation cache entry is still in use) */
+		if (useValidationCache) validationCache.touch(contentHash, contentSize);
+		logEntries.emplace_back("Board in: " + currBoardFullPath + " loaded succssefully from compiled board " + compiledBoardPath, Info);
+		writeBoardValidatedEvent(currBoardFilename, true, "compiled", loadStartMicros);
+		return std::make_unique<BoardGameTemplate>(std::move(compiledBoard), shipsDetailsA, shipsDetailsB);
 	}
 
-	std::set<std::pair<char, std::set<Coordinate>>> validShips_A, validShips_B;								/* for FindValidAndInvalidShipsInBoard output */
-	std::set<char> invalidShips_A, invalidShips_B;
+	BattleshipBoard currBoard(currBoardFullPath);
 
+	logEntries.emplace_back("Checking validity of board in: " + currBoardFullPath, Info);
 
-	FindValidAndInvalidShipsInBoard(board, validShips_A, invalidShips_A, validShips_B, invalidShips_B);
+	BoardsValidationCache::Entry validation;
+	bool isCacheable = useValidationCache && BattleshipGameUtils::hashFileContent(currBoardFullPath, contentHash, contentSize);
+	bool isValidBoard;
+	const char* validationSource = "parsed";
 
-	if (validShips_A.empty() || validShips_B.empty())
+	if (isCacheable && validationCache.find(contentHash, contentSize, validation) && validation.isOfBoard(currBoard))
 	{
-		Logger::append("One of the players (or both) has no ships at all - invalid board.", Warning);
-		return false;
+		/* this board content was already checked - take the messages and the result of its validation */
+		logEntries.insert(logEntries.end(), validation.validationLogs.begin(), validation.validationLogs.end());
+		isValidBoard = validation.isValid;
+		validationSource = "cache";
+		shipsDetailsA = std::move(validation.shipsDetailsA);
+		shipsDetailsB = std::move(validation.shipsDetailsB);
 	}
-	else {
-		PrintWrongSizeOrShapeForShips(invalidShips_A, A);
-		PrintWrongSizeOrShapeForShips(invalidShips_B, B);
+	else
+	{
+		auto validationLogsBegin = logEntries.size();
+		isValidBoard = checkBoardValidity(currBoard, shipsDetailsA, shipsDetailsB, logEntries);
 
-		comparePlayersShips(validShips_A, validShips_B);
+		if (isCacheable)
+		{
+			validation.isValid = isValidBoard;
+			validation.setBoard(currBoard);
+			validation.validationLogs.assign(logEntries.begin() + validationLogsBegin, logEntries.end());
+			validation.shipsDetailsA = shipsDetailsA;
+			validation.shipsDetailsB = shipsDetailsB;
+			validationCache.insert(contentHash, contentSize, std::move(validation));
+		}
+	}
 
-		bool hasAdjacentShips = board.CheckIfHasAdjacentShips();								/* if has adjacent ships, this funcion also prints relevant message */
-		if (hasAdjacentShips) Logger::append("Adjacent Ships on Board", Warning);
-		return (!hasAdjacentShips && invalidShips_A.empty() && invalidShips_B.empty());
+	writeBoardValidatedEvent(currBoardFilename, isValidBoard, validationSource, loadStartMicros);
+	if (!isValidBoard)
+	{
+		logEntries.emplace_back("Board in: " + currBoardFullPath + " skipped, because of the errors above", Warning);
+		return nullptr;
 	}
-}
 
+	logEntries.emplace_back("Board in: " + currBoardFullPath + " loaded succssefully", Info);
+	if (compileBoards)
+	{
+		if (CompiledBoard::write(compiledBoardPath, currBoardFullPath, currBoard, shipsDetailsA, shipsDetailsB))
+			logEntries.emplace_back("Compiled board written to: " + compiledBoardPath, Info);
+		else
+			logEntries.emplace_back("Failed writing compiled board to: " + compiledBoardPath, Warning);
+	}
+	return std::make_unique<BoardGameTemplate>(std::move(currBoard), shipsDetailsA, shipsDetailsB);	/* take the board without create new board, and build its game template once for all its games */
+}
 
-void BattleshipTournamentManager::FindValidAndInvalidShipsInBoard(const BattleshipBoard& board, std::set<std::pair<char, std::set<Coordinate>>>& validShips_A, std::set<char>& invalidShips_A, std::set<std::pair<char, std::set<Coordinate>>>& validShips_B, std::set<char>& invalidShips_B)
+void BattleshipTournamentManager::streamTournamentBoards()
 {
-	std::set<std::pair<char, std::set<Coordinate>>> setOfShipsDetails;					/* set of ships details - for example:
-																						{<'m', {<1,2,7>,<1,3,7>}> , <'P', {<8,5,1>, <8,6,1> , <8,7,1>}> } */
-	std::set<char> invalidShips;													 /* set of the invalid ships (to avoid duplicated ships in error messages) */
+	size_t validBoardsNum = 0;
 
-
-	setOfShipsDetails = board.ExtractShipsDetails();	         /* after this row, we have set of ships, maybe some of them invalid */
-
-	DeleteInvalidShipsDetailsEntryFromSet(setOfShipsDetails, invalidShips);				 /* after this row, we have only valid ships in setOfShipsDetails, and alse invalidShips  updated*/
-
-	for (auto validShipDeatils : setOfShipsDetails)
+	for (const auto& currBoardFilename : boardsFilenames)
 	{
-		if (BattleshipBoard::isPlayerShip(PLAYERID_A, validShipDeatils.first))
-			validShips_A.insert(validShipDeatils);
+		LogEntries boardLogs;
+		auto currBoard = loadBoard(currBoardFilename, boardLogs);
+		Logger::append(boardLogs);
 
-		else validShips_B.insert(validShipDeatils);
+		if (currBoard)
+		{
+			publishBoardGames(currBoardFilename, std::move(currBoard));
+			validBoardsNum++;
+		}
 	}
+	Logger::append("Number of valid bords: " + std::to_string(validBoardsNum), Info);
+	saveValidationCache();
 
-	for (auto invalidShipChar : invalidShips)
+	if (validBoardsNum == 0)
 	{
-		if (BattleshipBoard::isPlayerShip(PLAYERID_A, invalidShipChar))
-			invalidShips_A.insert(invalidShipChar);
-
-		else invalidShips_B.insert(invalidShipChar);
+		std::cout << "Error: No valid board files (*.sboard) looking in path: " << inputDirPath.c_str() << std::endl;
+		Logger::append("No valid boards in directory at all. no games were played", Error);
 	}
 
+	/* no more boards - the games threads can exit once the schedule is over, and the last round can be printed */
+	std::unique_lock<std::mutex> scheduleLock(scheduleMutex);
+	isScheduleDone = true;
+	scheduleLock.unlock();
+	newGamesCondition.notify_all();
+
+	std::unique_lock<std::mutex> roundsLock(isRoundDoneMutex);
+	isRoundsNumFinal = true;
+	roundsLock.unlock();
+	isRoundDoneCondition.notify_one();
+}
+
+void BattleshipTournamentManager::saveValidationCache()
+{
+	if (!useValidationCache) return;
+
+	auto cacheFilePath = inputDirPath + "/" + BoardsValidationCache::CACHE_FILENAME;
+	if (!validationCache.save(cacheFilePath))
+		Logger::append("Failed writing the boards validation cache to: " + cacheFilePath, Warning);
+}
+
+void BattleshipTournamentManager::publishBoardGames(const std::string& boardFilename, std::unique_ptr<BoardGameTemplate> board)
+{
+	std::unique_lock<std::mutex> scheduleLock(scheduleMutex);
+	boardsVec.push_back(std::move(*board));													/* no reallocation - the capacity is for all the board files */
+	auto boardIndex = static_cast<int>(boardsVec.size() - 1);
+	writeBoardAddedEvent(boardFilename, boardIndex);											/* before its games can start (buffered only - no file write under the schedule lock) */
+	appendBoardGames(boardIndex);
+	scheduleLock.unlock();
+	newGamesCondition.notify_all();
+
+	std::unique_lock<std::mutex> roundsLock(isRoundDoneMutex);
+	roundsNum += 2 * (algosDetailsVec.size() - 1);											/* every player plays twice against every other player on this board */
+	roundsLock.unlock();
+	isRoundDoneCondition.notify_one();														/* the last known round may be done already and wait for the next rounds to be printed */
 }
 
-void BattleshipTournamentManager::DeleteInvalidShipsDetailsEntryFromSet(std::set<std::pair<char, std::set<Coordinate>>>& setOfShipsDetails, std::set<char>& invalidShips)
+void BattleshipTournamentManager::writeBoardValidatedEvent(const std::string& boardFilename, bool isValidBoard, const char* source, long long loadStartMicros)
 {
-	auto it = setOfShipsDetails.begin();
-	while (it != setOfShipsDetails.end())
+	if (!eventLog.isOpen()) return;
+
+	eventLog.write(EventLog::Event(eventLog, "board_validated").add("file", boardFilename).add("valid", isValidBoard).add("source", source)
+		.add("duration_us", eventLog.elapsedMicros() - loadStartMicros));
+}
+
+void BattleshipTournamentManager::writeBoardAddedEvent(const std::string& boardFilename, int boardIndex)
+{
+	if (!eventLog.isOpen()) return;
+
+	const auto& mainBoard = boardsVec[boardIndex].getMainBoard();
+	eventLog.write(EventLog::Event(eventLog, "board_added").add("board", boardIndex).add("file", boardFilename)
+		.add("rows", mainBoard.getRows()).add("cols", mainBoard.getCols()).add("depth", mainBoard.getDepth()), false);
+}
+
+bool BattleshipTournamentManager::checkBoardValidity(const BattleshipBoard& board, std::vector<ShipDetails>& shipsDetailsA, std::vector<ShipDetails>& shipsDetailsB, LogEntries& logEntries)
+{
+	if (!board.isSuccessfullyCreated()) {
+		logEntries.emplace_back("failed Creating board", Warning);
+		return false;
+	}
+
+	auto report = BoardValidator::validate(board);														/* the checks below are all taken from the report */
+
+	if (!report.hasValidShips())
 	{
-		if (!Ship::isValidShipDetails(*it))
-		{
-		invalidShips.insert(it->first);
-		it = setOfShipsDetails.erase(it);
-		}
-		else
+		logEntries.emplace_back("One of the players (or both) has no ships at all - invalid board.", Warning);
+		return false;
+	}
+	else {
+		PrintWrongSizeOrShapeForShips(report.invalidShipsChars[PLAYERID_A], A, logEntries);
+		PrintWrongSizeOrShapeForShips(report.invalidShipsChars[PLAYERID_B], B, logEntries);
+
+		comparePlayersShips(report, logEntries);
+
+		if (report.hasAdjacentShips) logEntries.emplace_back("Adjacent Ships on Board", Warning);
+		if (!report.isValid()) return false;
+
+		if (report.validShips[PLAYERID_A].size() > ShipsBoardTemplate::MAX_SHIPS_NUM || report.validShips[PLAYERID_B].size() > ShipsBoardTemplate::MAX_SHIPS_NUM)
 		{
-			++it;
+			logEntries.emplace_back("Too many ships on board - at most " + std::to_string(ShipsBoardTemplate::MAX_SHIPS_NUM) + " ships for every player", Warning);
+			return false;
 		}
+
+		shipsDetailsA = std::move(report.validShips[PLAYERID_A]);								/* valid board - these are all the ships of the players */
+		shipsDetailsB = std::move(report.validShips[PLAYERID_B]);
+		return true;
 	}
 }
 
-void BattleshipTournamentManager::PrintWrongSizeOrShapeForShips(std::set<char>& invalidShipsSet, char playerChar)
+void BattleshipTournamentManager::PrintWrongSizeOrShapeForShips(const std::set<char>& invalidShipsSet, char playerChar, LogEntries& logEntries)
 {
 	if (invalidShipsSet.empty()) return;
 
@@ -242,61 +394,61 @@ void BattleshipTournamentManager::PrintWrongSizeOrShapeForShips(std::set<char>&
 	{
 		std::string tmpStr("");
 		tmpStr += shipChar;
-		Logger::append("Wrong size or shape for ship " + tmpStr + " for player " + playerChar, Warning); 
+		logEntries.emplace_back("Wrong size or shape for ship " + tmpStr + " for player " + playerChar, Warning);
 	}
 }
 
-void BattleshipTournamentManager::comparePlayersShips(std::set<std::pair<char, std::set<Coordinate>>>& validShips_A, std::set<std::pair<char, std::set<Coordinate>>>& validShips_B)
+void BattleshipTournamentManager::comparePlayersShips(const BoardValidationReport& report, LogEntries& logEntries)
 {
-	if (validShips_A.size() != validShips_B.size())
+	if (report.validShips[PLAYERID_A].size() != report.validShips[PLAYERID_B].size())
 	{
-		Logger::append("the board is not balanced, players have different number of ships", Warning);
+		logEntries.emplace_back("the board is not balanced, players have different number of ships", Warning);
 		return;
 	}
 
-	std::vector<std::pair<int, int>> shipsCountVec_A, shipsCountVec_B;
-
-	BattleshipBoard::countShipsTypes(validShips_A, shipsCountVec_A);
-	BattleshipBoard::countShipsTypes(validShips_B, shipsCountVec_B);
-	bool hasDiffTypesBalance = false;
-
-	if (shipsCountVec_A.size() != shipsCountVec_B.size())			/* we can have same number of ships, but different number from each type */
-		hasDiffTypesBalance = true;
-
-	else
+	bool hasDiffTypesBalance = false;																/* we can have same number of ships, but different number from each type */
+	for (auto shipType = 0; shipType < BoardValidationReport::SHIP_TYPES_NUM; shipType++)
 	{
-		for (int i = 0; i < shipsCountVec_A.size(); i++)			/* those vectors sorted by the ship type sizes */
-		{
-			if (shipsCountVec_A[i].first != shipsCountVec_A[i].first || shipsCountVec_A[i].second != shipsCountVec_A[i].second)
-				hasDiffTypesBalance = true;
-
-		}
+		if (report.shipsTypesCount[PLAYERID_A][shipType] != report.shipsTypesCount[PLAYERID_B][shipType])
+			hasDiffTypesBalance = true;
 	}
 
 	if (hasDiffTypesBalance)
-		Logger::append("the board is not balanced, players have same number of ships but not for each ship type", Warning);
+		logEntries.emplace_back("the board is not balanced, players have same number of ships but not for each ship type", Warning);
 }
 
 bool BattleshipTournamentManager::loadTournamentAlgos()
 {
-	std::string currDllFullPath;
-	auto tmpFilenamesVector = BattleshipGameUtils::SortedDirlistSpecificExtension(inputDirPath, ".dll");
+	auto tmpFilenamesVector = BattleshipGameUtils::SortedDirlistSpecificExtension(inputDirPath, AlgoLibraryLoader::LIB_EXTENSION);
 
-	if(tmpFilenamesVector.empty())
+	if(tmpFilenamesVector.empty() && builtinPlayersNames.empty())
 	{
-		std::cout << "Missing algorithm (dll) files looking in path: " << inputDirPath << " (needs at least two)" << std::endl;
+		std::cout << "Missing algorithm (" << AlgoLibraryLoader::LIB_EXTENSION << ") files looking in path: " << inputDirPath << " (needs at least two)" << std::endl;
 		return false;
 	}
 
-	for (auto currDllFilename : tmpFilenamesVector)
+	/* loading a library and resolving its symbols does not depend on the other libraries, so we load all of them in parallel.
+	 * every library has its own log entries, and we write them to the log afterwards by the files order */
+	std::vector<PlayerAlgoDetails> loadedAlgos(tmpFilenamesVector.size());
+	std::vector<LogEntries> loadedAlgosLogs(tmpFilenamesVector.size());
+	std::vector<char> isAlgoLoaded(tmpFilenamesVector.size(), false);								/* not vector<bool> - every thread writes its own entry */
+
+	BattleshipGameUtils::parallelFor(tmpFilenamesVector.size(), maxGamesThreads, [&](size_t i) {
+		isAlgoLoaded[i] = loadPlayerDll(tmpFilenamesVector[i], loadedAlgos[i], loadedAlgosLogs[i]);
+	});
+
+	for (size_t i = 0; i < tmpFilenamesVector.size(); i++)
 	{
-		loadPlayerDll(currDllFilename);
+		Logger::append(loadedAlgosLogs[i]);
+		if (isAlgoLoaded[i])
+			algosDetailsVec.push_back(std::move(loadedAlgos[i]));
 	}
+	loadBuiltinAlgos();
 
 	Logger::append("Number of valid algos: " + std::to_string(algosDetailsVec.size()), Info);
 	if (algosDetailsVec.size() < TOURNAMENT_MIN_PLAYERS)
 	{
-		std::cout << "Error: Missing minimum number of required Valid algorithm (dll) files looking in path: " << inputDirPath << " (needs at least " << TOURNAMENT_MIN_PLAYERS << ")" << std::endl;
+		std::cout << "Error: Missing minimum number of required Valid algorithm (" << AlgoLibraryLoader::LIB_EXTENSION << ") files looking in path: " << inputDirPath << " (needs at least " << TOURNAMENT_MIN_PLAYERS << ")" << std::endl;
 		Logger::append("Directory does not have enough valid algos. Exiting...", Error);
 		return false;
 	}
@@ -305,38 +457,89 @@ bool BattleshipTournamentManager::loadTournamentAlgos()
 
 }
 
-bool BattleshipTournamentManager::loadPlayerDll(const std::string& currDllFilename)
+bool BattleshipTournamentManager::loadPlayerDll(const std::string& currDllFilename, PlayerAlgoDetails& currAlgo, LogEntries& logEntries) const
 {
-	PlayerAlgoDetails currAlgo;
 	currAlgo.dllPath = inputDirPath + "/" + currDllFilename;
-	currAlgo.playerName = currDllFilename.substr(0, currDllFilename.find(".dll"));
+	currAlgo.playerName = currDllFilename.substr(0, currDllFilename.find(AlgoLibraryLoader::LIB_EXTENSION));
 
 
-	Logger::append("Trying to load dll player algo in: " + currAlgo.dllPath, Info); 
-	currAlgo.dllFileHandle = LoadLibraryA(currAlgo.dllPath.c_str()); // Notice: Unicode compatible version of LoadLibrary
+	logEntries.emplace_back("Trying to load dll player algo in: " + currAlgo.dllPath, Info); 
+	currAlgo.dllFileHandle = AlgoLibraryLoader::open(currAlgo.dllPath);
 
 	if (!currAlgo.dllFileHandle)
 	{
-		Logger::append("Cannot load dll in: " + currAlgo.dllPath, Warning); 
+		logEntries.emplace_back("Cannot load dll in: " + currAlgo.dllPath + " (" + AlgoLibraryLoader::lastError() + ")", Warning); 
 		return false;
 	}
 	else
 	{
-		Logger::append("Trying to get the GetAlgorithm function from the dll file", Debug); 
-		currAlgo.getAlgoFunc = reinterpret_cast<GetAlgoFuncType>(GetProcAddress(currAlgo.dllFileHandle, "GetAlgorithm"));
-		if (!currAlgo.getAlgoFunc)
+		logEntries.emplace_back("Trying to get the GetAlgorithm function from the dll file", Debug); 
+		currAlgo.getAlgoFunc = reinterpret_cast<GetAlgoFuncType>(AlgoLibraryLoader::getSymbol(currAlgo.dllFileHandle, "GetAlgorithm"));
+		loadPlayerDllV2EntryPoints(currAlgo, logEntries);
+		if (!currAlgo.getAlgoFunc && !currAlgo.getAlgoV2Func)
 		{
-			Logger::append("Error getting GetAlgorithm function from the dll file in: " + currAlgo.dllPath,Warning);
-			FreeLibrary(currAlgo.dllFileHandle);
+			logEntries.emplace_back("Error getting GetAlgorithm function from the dll file in: " + currAlgo.dllPath,Warning);
+			AlgoLibraryLoader::close(currAlgo.dllFileHandle);
+			currAlgo.dllFileHandle = nullptr;
 			return false;
 		}
-		Logger::append("Success loading player algorithm from dll in: " + currAlgo.dllPath, Info);  
+		logEntries.emplace_back("Success loading player algorithm from dll in: " + currAlgo.dllPath, Info);  
 	}
 
-	algosDetailsVec.push_back(std::move(currAlgo));
 	return true;
 }
 
+void BattleshipTournamentManager::loadBuiltinAlgos()
+{
+	for (const auto& algoName : builtinPlayersNames)
+	{
+		auto builtinAlgoIndex = BuiltinAlgos::findAlgoIndex(algoName);
+		if (builtinAlgoIndex == BuiltinAlgos::UNDEFINED_ALGO_INDEX)
+		{
+			Logger::append("There is no built-in algo named: " + algoName + ". skipping it", Warning);
+			continue;
+		}
+
+		PlayerAlgoDetails currAlgo;
+		currAlgo.builtinAlgoIndex = builtinAlgoIndex;
+		currAlgo.playerName = algoName;
+		auto sameNameCount = std::count_if(algosDetailsVec.begin(), algosDetailsVec.end(), [&algoName](const PlayerAlgoDetails& algo) { return algo.isBuiltin() && BuiltinAlgos::algoName(algo.builtinAlgoIndex) == algoName; });
+		if (sameNameCount > 0)																/* the same built-in algo can play more than once (self-play), give every copy its own name in the tables */
+			currAlgo.playerName += "_" + std::to_string(sameNameCount + 1);
+
+		Logger::append("Built-in player algorithm " + currAlgo.playerName + " added", Info);
+		algosDetailsVec.push_back(std::move(currAlgo));
+	}
+}
+
+void BattleshipTournamentManager::loadPlayerDllV2EntryPoints(PlayerAlgoDetails& currAlgo, LogEntries& logEntries)
+{
+	auto getAlgoV2Func = reinterpret_cast<GetAlgoV2FuncType>(AlgoLibraryLoader::getSymbol(currAlgo.dllFileHandle, "GetAlgorithmV2"));
+	if (!getAlgoV2Func) return;																		/* v1 dll */
+
+	auto destroyAlgoFunc = reinterpret_cast<DestroyAlgoFuncType>(AlgoLibraryLoader::getSymbol(currAlgo.dllFileHandle, "DestroyAlgorithm"));
+	if (!destroyAlgoFunc)
+	{
+		logEntries.emplace_back("dll in: " + currAlgo.dllPath + " exports GetAlgorithmV2 without DestroyAlgorithm, we will use only GetAlgorithm", Warning);
+		return;
+	}
+
+	auto testInstance = getAlgoV2Func(ALGO_ABI_VERSION);											/* the dll returns nullptr if it does not support our abi version */
+	if (!testInstance)
+	{
+		logEntries.emplace_back("dll in: " + currAlgo.dllPath + " does not support algo ABI version " + std::to_string(ALGO_ABI_VERSION) + ", we will use only GetAlgorithm", Warning);
+		return;
+	}
+	destroyAlgoFunc(testInstance);
+
+	currAlgo.getAlgoV2Func = getAlgoV2Func;
+	currAlgo.destroyAlgoFunc = destroyAlgoFunc;
+	currAlgo.resetAlgoFunc = reinterpret_cast<ResetAlgoFuncType>(AlgoLibraryLoader::getSymbol(currAlgo.dllFileHandle, "ResetAlgorithm"));
+	currAlgo.setTimeBudgetFunc = reinterpret_cast<SetAlgoTimeBudgetFuncType>(AlgoLibraryLoader::getSymbol(currAlgo.dllFileHandle, "SetAlgorithmTimeBudget"));
+	currAlgo.setHelperPoolFunc = reinterpret_cast<SetAlgoHelperPoolFuncType>(AlgoLibraryLoader::getSymbol(currAlgo.dllFileHandle, "SetAlgorithmHelperPool"));
+	logEntries.emplace_back("Using algo ABI version " + std::to_string(ALGO_ABI_VERSION) + " entry points of dll in: " + currAlgo.dllPath, Debug);
+}
+
 /* we assume that the config file has values from the form: <ARG>=<VALUE> (with no spaces) */
 void BattleshipTournamentManager::parseDefaultsFromConfigFile() 
 {
@@ -344,6 +547,17 @@ void BattleshipTournamentManager::parseDefaultsFromConfigFile()
 	BattleshipPrint::setPrintOneTable(PRINT_SINGLE_TABLE);
 	BattleshipPrint::setDelay(BattleshipPrint::printDefaultDealy);
 	TOURNAMENT_MIN_PLAYERS = TOURNAMENT_MIN_PLAYERS_DEFAULT;
+	roundRobinSchedule = ROUND_ROBIN_SCHEDULE_DEFAULT;
+	reuseAlgoInstances = REUSE_ALGO_INSTANCES_DEFAULT;
+	streamingPipeline = STREAMING_PIPELINE_DEFAULT;
+	useValidationCache = BOARDS_VALIDATION_CACHE_DEFAULT;
+	compileBoards = COMPILE_BOARDS_DEFAULT;
+	asyncLogger = ASYNC_LOGGER_DEFAULT;
+	writeEventLog = EVENT_LOG_DEFAULT;
+	moveTimeBudgetMicros = MOVE_TIME_BUDGET_US_DEFAULT;
+	gameTimeBudgetMicros = GAME_TIME_BUDGET_US_DEFAULT;
+	algoHelperThreadsNum = ALGO_HELPER_THREADS_DEFAULT;
+	builtinPlayersNames.clear();
 
 	if (tmpFilenamesVector.empty())
 	{
@@ -377,6 +591,14 @@ void BattleshipTournamentManager::parseDefaultsFromConfigFile()
 
 void BattleshipTournamentManager::storeConfigLine(const std::string& key, const std::string& value)
 {
+	if (strcmp(key.c_str(), "BUILTIN_PLAYERS") == 0)					/* the only key with a string value (names list) */
+	{
+		builtinPlayersNames.clear();
+		BattleshipGameUtils::splitStringByToken(value, ',', std::back_inserter(builtinPlayersNames));
+		LOG_DEBUG("set default value from config file, KEY = ", key, "\t VALUE = ", value);
+		return;
+	}
+
 	char* stringEnd = nullptr;
 	int intValue = static_cast<size_t>(strtol(value.c_str(), &stringEnd, 10));
 	if (*stringEnd || intValue < 0)
@@ -407,27 +629,88 @@ void BattleshipTournamentManager::storeConfigLine(const std::string& key, const
 		validConfigAssign = true;
 		TOURNAMENT_MIN_PLAYERS = intValue;
 	}
+	else if (strcmp(key.c_str(), "ROUND_ROBIN_SCHEDULE") == 0)
+	{
+		validConfigAssign = true;
+		roundRobinSchedule = (intValue ? true : false);
+	}
+	else if (strcmp(key.c_str(), "REUSE_ALGO_INSTANCES") == 0)
+	{
+		validConfigAssign = true;
+		reuseAlgoInstances = (intValue ? true : false);
+	}
+	else if (strcmp(key.c_str(), "STREAMING_PIPELINE") == 0)
+	{
+		validConfigAssign = true;
+		streamingPipeline = (intValue ? true : false);
+	}
+	else if (strcmp(key.c_str(), "COMPILE_BOARDS") == 0)
+	{
+		validConfigAssign = true;
+		compileBoards = (intValue ? true : false);
+	}
+	else if (strcmp(key.c_str(), "BOARDS_VALIDATION_CACHE") == 0)
+	{
+		validConfigAssign = true;
+		useValidationCache = (intValue ? true : false);
+	}
+	else if (strcmp(key.c_str(), "ASYNC_LOGGER") == 0)
+	{
+		validConfigAssign = true;
+		asyncLogger = (intValue ? true : false);
+	}
+	else if (strcmp(key.c_str(), "EVENT_LOG") == 0)
+	{
+		validConfigAssign = true;
+		writeEventLog = (intValue ? true : false);
+	}
+	else if (strcmp(key.c_str(), "MOVE_TIME_BUDGET_US") == 0)
+	{
+		validConfigAssign = true;
+		moveTimeBudgetMicros = intValue;
+	}
+	else if (strcmp(key.c_str(), "GAME_TIME_BUDGET_US") == 0)
+	{
+		validConfigAssign = true;
+		gameTimeBudgetMicros = intValue;
+	}
+	else if (strcmp(key.c_str(), "ALGO_HELPER_THREADS") == 0)
+	{
+		validConfigAssign = true;
+		algoHelperThreadsNum = intValue;
+	}
 	else if (strcmp(key.c_str(), "LOG_LEVEL") == 0)
 	{
 		validConfigAssign = true;
 		logLevelVal = static_cast<LogLevel>(intValue);
 	}
-	if(validConfigAssign) Logger::append("set default value from config file, KEY = " + key + "\t VALUE = " + std::to_string(intValue), Debug);
+	if(validConfigAssign) LOG_DEBUG("set default value from config file, KEY = ", key, "\t VALUE = ", intValue);
 }
 
 void BattleshipTournamentManager::printRouondGameResToLog(int currRound) const
 {
+	if (!Logger::isEnabled(Debug)) return;															/* the results table is built only for the log */
+
 	std::string currRoundGamesResultsStr = "";
 	for (auto i = 0; i < algosDetailsVec.size(); i++)
 	{
 		std::string res = "";
-		if (allGamesResults[i][currRound].WinsNumber()) res = "Won";
-		else if (allGamesResults[i][currRound].LossesNumber()) res = "Lost";
+		if (allGamesResults[currRound][i].WinsNumber()) res = "Won";
+		else if (allGamesResults[currRound][i].LossesNumber()) res = "Lost";
 		else res = "tied";
 	
-		currRoundGamesResultsStr += "\t\t\t\t\t\t\t\t\tPlayer: " + std::to_string(i) + "(" + algosDetailsVec[i].playerName + ") " + res + "\t" + std::to_string(allGamesResults[i][currRound].PointsFor()) + " : " + std::to_string(allGamesResults[i][currRound].PointsAgainst()) + "\n";
+		currRoundGamesResultsStr += "\t\t\t\t\t\t\t\t\tPlayer: " + std::to_string(i) + "(" + algosDetailsVec[i].playerName + ") " + res + "\t" + std::to_string(allGamesResults[currRound][i].PointsFor()) + " : " + std::to_string(allGamesResults[currRound][i].PointsAgainst()) + "\n";
 	}
-	Logger::append("Games results in round " + std::to_string(currRound+1) + ":\n" + currRoundGamesResultsStr, Debug);
+	LOG_DEBUG("Games results in round ", currRound + 1, ":\n", currRoundGamesResultsStr);
+}
+
+size_t BattleshipTournamentManager::remainingGamesNum()
+{
+	std::unique_lock<std::mutex> scheduleLock(scheduleMutex);											/* in streaming mode, the schedule may grow right now */
+	auto scheduledGames = gamesPropertiesVec.size();
+	scheduleLock.unlock();
+	auto gamesTaken = std::min(nextGameIndex.load(), scheduledGames);
+	return scheduledGames - gamesTaken;
 }
 
 void BattleshipTournamentManager::printProgramValuesToLog() const
@@ -436,77 +719,191 @@ void BattleshipTournamentManager::printProgramValuesToLog() const
 	Logger::append("MAX_THREADS_NUM set to:\t" + std::to_string(maxGamesThreads), Info);
 	Logger::append("PRINT_SINGLE_TABLE set to:\t" + std::to_string(PRINT_SINGLE_TABLE), Info);
 	Logger::append("TOURNAMENT_MIN_PLAYERS set to:\t" + std::to_string(TOURNAMENT_MIN_PLAYERS), Info);
+	Logger::append("ROUND_ROBIN_SCHEDULE set to:\t" + std::to_string(roundRobinSchedule), Info);
+	Logger::append("REUSE_ALGO_INSTANCES set to:\t" + std::to_string(reuseAlgoInstances), Info);
+	Logger::append("STREAMING_PIPELINE set to:\t" + std::to_string(streamingPipeline), Info);
+	Logger::append("COMPILE_BOARDS set to:\t" + std::to_string(compileBoards), Info);
+	Logger::append("BOARDS_VALIDATION_CACHE set to:\t" + std::to_string(useValidationCache), Info);
+	Logger::append("ASYNC_LOGGER set to:\t" + std::to_string(asyncLogger), Info);
+	Logger::append("EVENT_LOG set to:\t" + std::to_string(writeEventLog), Info);
+	Logger::append("MOVE_TIME_BUDGET_US set to:\t" + std::to_string(moveTimeBudgetMicros), Info);
+	Logger::append("GAME_TIME_BUDGET_US set to:\t" + std::to_string(gameTimeBudgetMicros), Info);
+	Logger::append("ALGO_HELPER_THREADS set to:\t" + std::to_string(algoHelperThreadsNum), Info);
+	for (const auto& algoName : builtinPlayersNames)
+		Logger::append("BUILTIN_PLAYERS contains:\t" + algoName, Info);
 }
 
 void BattleshipTournamentManager::RunTournament()	
 {
-	maxGamesThreads = (maxGamesThreads > gamesPropertiesQueue.size() ? gamesPropertiesQueue.size() : maxGamesThreads); /* in case there are more threads then games */
+	auto maxNumOfGames = (streamingPipeline ? gamesPropertiesVec.capacity() : gamesPropertiesVec.size());
+	maxGamesThreads = (maxGamesThreads > maxNumOfGames ? maxNumOfGames : maxGamesThreads); /* in case there are more threads then games */
 	Logger::append("Number of Games threads set to:\t" + std::to_string(maxGamesThreads), Info);
 	
 	std::vector <std::thread> threadsPool;
 	threadsPool.reserve(maxGamesThreads);
+
+	/* the algos helper threads are shared by all the games, and only take the cores that the games threads leave free */
+	auto freeCoresNum = static_cast<int>(std::thread::hardware_concurrency()) - static_cast<int>(maxGamesThreads);
+	auto helperThreadsNum = std::min(algoHelperThreadsNum, freeCoresNum);
+	if (helperThreadsNum > 0)
+		algoHelperPool = std::make_unique<AlgoHelperPool>(helperThreadsNum);
+	Logger::append("Number of algos helper threads set to:\t" + std::to_string(std::max(helperThreadsNum, 0)), Info);
 	
 	Logger::append("START running tournament games...", Info);
+	if (eventLog.isOpen())
+		eventLog.write(EventLog::Event(eventLog, "tournament_start").add("players", algosDetailsVec.size()).add("max_games", maxNumOfGames).add("threads", maxGamesThreads));
 	
 	for (auto i = 0; i< maxGamesThreads; i++)
 	{
-		threadsPool.emplace_back(std::thread(&BattleshipTournamentManager::singleThreadJob, this));	 /* creating a pool of threads */
-		Logger::append("New thread created", Debug);
+		threadsPool.emplace_back(std::thread(&BattleshipTournamentManager::singleThreadJob, this, i));	 /* creating a pool of threads */
+		LOG_DEBUG("New thread created");
 	}
-	int currRound = 0;
+
+	std::thread boardsLoader;
+	if (streamingPipeline)
+		boardsLoader = std::thread(&BattleshipTournamentManager::streamTournamentBoards, this);	/* the games of every valid board are played as soon as it is loaded */
+
+	size_t currRound = 0;
 	
-	while (currRound < allRoundsData.size()) {														/* while there are more rounds to print keep waiting for next round */
+	while (true) {																					/* while there are more rounds to print keep waiting for next round */
 
 		std::unique_lock<std::mutex> lk(isRoundDoneMutex);
 		
-		isRoundDoneCondition.wait(lk, [&]() {return allRoundsData[currRound].isRoundDone; });		/* waiting for current round to end by order (first till last) */
+		/* waiting for current round to end by order (first till last), or for the end of the tournament (in streaming mode, roundsNum grows until all the boards are loaded,
+		 * so the last known round is printed only when more rounds are added or it is the last round of the tournament) */
+		isRoundDoneCondition.wait(lk, [&]() {return currRound < roundsNum ? allRoundsData[currRound].isRoundDone && (currRound + 1 < roundsNum || isRoundsNumFinal) : isRoundsNumFinal; });
+		auto knownRoundsNum = roundsNum;
 		lk.unlock();
-		
-		printRouondGameResToLog(currRound);
+
+		if (currRound >= knownRoundsNum) break;														/* all the rounds are printed */
 
 		if (allRoundsData[currRound].isRoundDone) {															/* sanity check in case of spurious wake up */
+			printRouondGameResToLog(currRound);
 			for (auto i = 0; i < algosDetailsVec.size(); i++) {												/* update sum fileds for current round  */
-				allRoundsCumulativeData[i].winsCnt += allGamesResults[i][currRound].winsCnt;
-				allRoundsCumulativeData[i].lossesCnt += allGamesResults[i][currRound].lossesCnt;
-				allRoundsCumulativeData[i].pointsFor += allGamesResults[i][currRound].pointsFor;
-				allRoundsCumulativeData[i].pointsAgainst += allGamesResults[i][currRound].pointsAgainst;
+				allRoundsCumulativeData[i].winsCnt += allGamesResults[currRound][i].winsCnt;
+				allRoundsCumulativeData[i].lossesCnt += allGamesResults[currRound][i].lossesCnt;
+				allRoundsCumulativeData[i].pointsFor += allGamesResults[currRound][i].pointsFor;
+				allRoundsCumulativeData[i].pointsAgainst += allGamesResults[currRound][i].pointsAgainst;
 			}
-			Logger::append("before printing round " + std::to_string((currRound + 1)) + ":\t" + std::to_string(gamesPropertiesQueue.size()) + " Games remaining to play" , Debug);	
-			BattleshipPrint::printStandingsTable(allRoundsCumulativeData, currRound + 1, allRoundsData.size());		/* printing current round data */
+			std::vector<PlayerGameResultData>().swap(allGamesResults[currRound]);							/* this round is done and summed, no thread will touch its results again */
+			if (Logger::isEnabled(Debug))																		/* remainingGamesNum() takes the schedule lock - only for the log */
+				LOG_DEBUG("before printing round ", currRound + 1, ":\t", remainingGamesNum(), " Games remaining to play");
+			BattleshipPrint::printStandingsTable(allRoundsCumulativeData, currRound + 1, knownRoundsNum);			/* printing current round data */
 			currRound++;																							/* next round to wait for */
 		}
 	}
+	if (boardsLoader.joinable()) boardsLoader.join();
 	for (auto & t : threadsPool) {
 		t.join();
 	}
+	algoHelperPool.reset();																			/* the games threads destroyed their algos - no algo uses the pool */
 	Logger::append("FINISH all tournament games and tables prints", Info);
+	if (eventLog.isOpen())
+		eventLog.write(EventLog::Event(eventLog, "tournament_end").add("boards", boardsVec.size()).add("games", std::min(nextGameIndex.load(), gamesPropertiesVec.size())));
+	eventLog.close();
 }
 
-void BattleshipTournamentManager::singleThreadJob()
+void BattleshipTournamentManager::singleThreadJob(int threadIndex)
 {
-	while (!gamesPropertiesQueue.empty())
+	std::vector<AlgoInstancePtr> threadAlgos(algosDetailsVec.size());							/* this thread's algos instances, one per player (the player can not play against himself) */
+	MonotonicArena gameArena;																	/* the ships state of the current game - reset before every game */
+
+	const SingleGameProperties* currGamePropertiesPtr;
+	const BoardGameTemplate* currGameBoard;
+	int threadGamesNum = 0;
+
+	if (eventLog.isOpen())
+		eventLog.write(EventLog::Event(eventLog, "thread_start").add("thread", threadIndex));
+
+	while (takeNextGame(currGamePropertiesPtr, currGameBoard))
 	{
-		std::unique_lock<std::mutex> lock(gamesQueueMutex);				/* we lock here to deal with the games queue */
-		
-		if (gamesPropertiesQueue.empty()) {								/* if the queue is empty, we are done -> no new games will be inserted to the queue */
-			return;														/* lock is unlocked here */
+		const auto& currGameProperties = *currGamePropertiesPtr;
+		auto gameIndex = currGamePropertiesPtr - gamesPropertiesVec.data();						/* the schedule is never reallocated while the threads are running */
+		auto gameStartMicros = 0LL;
+		if (eventLog.isOpen())
+		{
+			gameStartMicros = eventLog.elapsedMicros();
+			eventLog.write(EventLog::Event(eventLog, "game_start").add("game", gameIndex).add("thread", threadIndex).add("board", currGameProperties.getBoardIndex())
+				.add("player_a", currGameProperties.getPlayerIndexA()).add("player_b", currGameProperties.getPlayerIndexB()));
 		}
-		auto currGameProperties = gamesPropertiesQueue.front();			/* takes the next game form the queue */
-		gamesPropertiesQueue.pop();
-		lock.unlock();
 
-		std::unique_ptr<IBattleshipGameAlgo> playerAlgoA(algosDetailsVec[currGameProperties.getPlayerIndexA()].getAlgoFunc());
-		std::unique_ptr<IBattleshipGameAlgo> playerAlgoB(algosDetailsVec[currGameProperties.getPlayerIndexB()].getAlgoFunc());
+		auto playerAlgoA = getThreadAlgoInstance(currGameProperties.getPlayerIndexA(), threadAlgos);
+		auto playerAlgoB = getThreadAlgoInstance(currGameProperties.getPlayerIndexB(), threadAlgos);
 
-		/* we take the relevant 2 pointers from the players vetrors, and insert them to unique ptrs -> then we will move the move the responsibility for those ptrs to the (single) game manager */
+		/* the instances stay in threadAlgos (this thread is the owner), the (single) game manager only uses them */
 
-		BattleshipGameManager currGame(boardsVec[currGameProperties.getBoardIndex()], std::move(playerAlgoA), std::move(playerAlgoB));
+		gameArena.reset();																		/* the previous game was destroyed at the end of the last iteration */
+		BattleshipGameManager currGame(*currGameBoard, playerAlgoA, playerAlgoB, &gameArena);
+
+		const auto& algoDetailsA = algosDetailsVec[currGameProperties.getPlayerIndexA()];
+		const auto& algoDetailsB = algosDetailsVec[currGameProperties.getPlayerIndexB()];
 	
-		auto currGameResult = currGame.Run();						/* the game result returned is from the perspective of playerA */
+		/* the game result returned is from the perspective of playerA. two built-in algos play with their concrete types (no virtual calls) */
+		auto currGameResult = (algoDetailsA.isBuiltin() && algoDetailsB.isBuiltin()) ?
+			BuiltinAlgos::runGame(algoDetailsA.builtinAlgoIndex, algoDetailsB.builtinAlgoIndex, currGame) : currGame.Run();
 		
+		if (!reuseAlgoInstances) {									/* algos that are not reusable are deleted at the end of every game */
+			threadAlgos[currGameProperties.getPlayerIndexA()].reset();
+			threadAlgos[currGameProperties.getPlayerIndexB()].reset();
+		}
+
+		if (eventLog.isOpen())
+		{
+			auto winner = (currGameResult.WinsNumber() ? "A" : (currGameResult.LossesNumber() ? "B" : "tie"));
+			eventLog.write(EventLog::Event(eventLog, "game_end").add("game", gameIndex).add("thread", threadIndex).add("board", currGameProperties.getBoardIndex())
+				.add("player_a", currGameProperties.getPlayerIndexA()).add("player_b", currGameProperties.getPlayerIndexB())
+				.add("duration_us", eventLog.elapsedMicros() - gameStartMicros).add("moves_a", currGame.getMovesCount(PLAYERID_A)).add("moves_b", currGame.getMovesCount(PLAYERID_B))
+				.add("score_a", currGameResult.PointsFor()).add("score_b", currGameResult.PointsAgainst()).add("winner", winner));
+		}
+		threadGamesNum++;
+
 		updateGamesResults(currGameResult, currGameProperties.getPlayerIndexA(), currGameProperties.getPlayerIndexB());
 		
 	}
+
+	if (eventLog.isOpen())
+		eventLog.write(EventLog::Event(eventLog, "thread_end").add("thread", threadIndex).add("games", threadGamesNum));
+}
+
+bool BattleshipTournamentManager::takeNextGame(const SingleGameProperties*& gameProperties, const BoardGameTemplate*& gameBoard)
+{
+	if (!streamingPipeline)
+	{
+		/* the schedule is not changed while the threads are running, so every thread only has to claim the next index atomically.
+		 * when the counter passes the end of the schedule we are done -> no new games will be added */
+		auto gameIndex = nextGameIndex++;
+		if (gameIndex >= gamesPropertiesVec.size()) return false;
+
+		gameProperties = &gamesPropertiesVec[gameIndex];
+		gameBoard = &boardsVec[gameProperties->getBoardIndex()];
+		return true;
+	}
+
+	/* streaming mode - the schedule grows while the threads are running, so the index is claimed under the lock, and the thread waits for its game.
+	 * the elements are never moved (see createGamesPropertiesSchedule), so they can be used after the lock is released */
+	std::unique_lock<std::mutex> scheduleLock(scheduleMutex);
+	auto gameIndex = nextGameIndex++;
+	newGamesCondition.wait(scheduleLock, [&]() { return gameIndex < gamesPropertiesVec.size() || isScheduleDone; });
+	if (gameIndex >= gamesPropertiesVec.size()) return false;
+
+	gameProperties = &gamesPropertiesVec[gameIndex];
+	gameBoard = &boardsVec[gameProperties->getBoardIndex()];
+	return true;
+}
+
+IBattleshipGameAlgo* BattleshipTournamentManager::getThreadAlgoInstance(int playerIndex, std::vector<AlgoInstancePtr>& threadAlgos) const
+{
+	if (!threadAlgos[playerIndex])
+		threadAlgos[playerIndex] = algosDetailsVec[playerIndex].createAlgoInstance();
+	else
+		algosDetailsVec[playerIndex].resetAlgoInstance(threadAlgos[playerIndex].get());			/* reused instance - let the dll clear the previous game state */
+
+	if (moveTimeBudgetMicros > 0 || gameTimeBudgetMicros > 0)
+		algosDetailsVec[playerIndex].setAlgoTimeBudget(threadAlgos[playerIndex].get(), moveTimeBudgetMicros, gameTimeBudgetMicros);
+	if (algoHelperPool)
+		algosDetailsVec[playerIndex].setAlgoHelperPool(threadAlgos[playerIndex].get(), algoHelperPool.get());
+
+	return threadAlgos[playerIndex].get();
 }
 
 
@@ -518,8 +915,8 @@ void BattleshipTournamentManager::updateGamesResults(const PlayerGameResultData&
 	int currRoundB = playersProgress[playerIndexB]++;		/* checks for each players in which round he is now (how many games he played */
 
 	// update allGamesResults in the relevent indexes
-	allGamesResults[playerIndexA][currRoundA] = currGameResultA;				/* update the game result in each from the 2 players*/
-	allGamesResults[playerIndexB][currRoundB] = currGameResultB;
+	allGamesResults[currRoundA][playerIndexA] = currGameResultA;				/* update the game result in each from the 2 players*/
+	allGamesResults[currRoundB][playerIndexB] = currGameResultB;
 
 
 	if (--allRoundsData[currRoundA].numOfPlayersLeft == 0) {		/* checks if this game cause to round of player A to be done */
@@ -539,19 +936,64 @@ void BattleshipTournamentManager::updateGamesResults(const PlayerGameResultData&
 }
 
 
-void BattleshipTournamentManager::createGamesPropertiesQueue()
+void BattleshipTournamentManager::createGamesPropertiesSchedule()
 {
+	auto numOfBoards = (streamingPipeline ? boardsFilenames.size() : boardsVec.size());
+	gamesPropertiesVec.reserve(numOfBoards * algosDetailsVec.size() * (algosDetailsVec.size() - 1));
+
+	if (streamingPipeline)
+	{
+		/* the games are scheduled by every board that is loaded (see publishBoardGames). the reserve above is also for all the board files,
+		 * so gamesPropertiesVec and boardsVec are never reallocated, and the games threads can keep using their elements while new ones are added */
+		boardsVec.reserve(numOfBoards);
+		return;
+	}
+
 	for (auto k = 0; k < boardsVec.size(); k++)
+		appendBoardGames(k);
+
+}
+
+void BattleshipTournamentManager::appendBoardGames(int boardIndex)
+{
+	if (roundRobinSchedule)
 	{
-		for (auto i = 0; i < algosDetailsVec.size(); i++)
+		appendRoundRobinBoardGames(boardIndex);
+		return;
+	}
+	for (auto i = 0; i < algosDetailsVec.size(); i++)
+	{
+		for (auto j = 0; j < algosDetailsVec.size(); j++)
 		{
-			for (auto j = 0; j < algosDetailsVec.size(); j++)
-			{
-				if (i != j) {												    /* player can not play against himself*/
-					gamesPropertiesQueue.emplace(SingleGameProperties(k, i, j));
-				}
+			if (i != j) {												    /* player can not play against himself*/
+				gamesPropertiesVec.emplace_back(boardIndex, i, j);
 			}
 		}
 	}
+}
+
+
+void BattleshipTournamentManager::appendRoundRobinBoardGames(int boardIndex)
+{
+	auto numOfPlayers = static_cast<int>(algosDetailsVec.size());
+	auto circleSize = (numOfPlayers % 2 == 0 ? numOfPlayers : numOfPlayers + 1);		/* for odd number of players we add a dummy player - playing against him is a bye */
+	auto roundsInLeg = circleSize - 1;
+
+	for (auto leg = 0; leg < 2; leg++)													/* leg 0 - home games, leg 1 - the same rounds with away games */
+	{
+		for (auto r = 0; r < roundsInLeg; r++)
+		{
+			for (auto i = 0; i < circleSize / 2; i++)
+			{
+				/* circle method - the last player is fixed and all the others rotate by one place every round */
+				auto home = (i == 0 ? circleSize - 1 : (r + i) % roundsInLeg);
+				auto away = (r + roundsInLeg - i) % roundsInLeg;
+
+				if (home >= numOfPlayers || away >= numOfPlayers) continue;			/* bye */
 
+				if ((r + leg) % 2 == 1) std::swap(home, away);							/* alternate home and away between rounds and legs */
+				gamesPropertiesVec.emplace_back(boardIndex, home, away);
+			}
+		}
+	}
 }
@@ -1,15 +1,21 @@
 #pragma once
 
 #include "BattleshipBoard.h"
+#include "BoardGameTemplate.h"
 #include "PlayerAlgoDetails.h"
-#include <queue> 
+#include <vector>
 #include "BattleshipGameManager.h"
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
 #include "PlayerGameResultData.h"
 #include "SingleGameProperties.h"
 #include "RoundData.h"
 #include "Logger.h"
+#include "BoardsValidationCache.h"
+#include "BoardValidator.h"
+#include "EventLog.h"
+#include "AlgoHelperPool.h"
 
 
 class BattleshipTournamentManager
@@ -27,6 +33,16 @@ private:
 	static const int TOURNAMENT_MIN_PLAYERS_DEFAULT = 2;
 	static const size_t DEFAULT_THREADS_NUM = 4;
 	static const bool PRINT_SINGLE_TABLE = false;
+	static const bool ROUND_ROBIN_SCHEDULE_DEFAULT = false;
+	static const bool REUSE_ALGO_INSTANCES_DEFAULT = true;
+	static const bool STREAMING_PIPELINE_DEFAULT = false;
+	static const bool COMPILE_BOARDS_DEFAULT = false;
+	static const bool BOARDS_VALIDATION_CACHE_DEFAULT = false;
+	static const bool ASYNC_LOGGER_DEFAULT = false;
+	static const bool EVENT_LOG_DEFAULT = false;
+	static const int MOVE_TIME_BUDGET_US_DEFAULT = 0;										/* no budget */
+	static const int GAME_TIME_BUDGET_US_DEFAULT = 0;
+	static const int ALGO_HELPER_THREADS_DEFAULT = 0;										/* the algos use only the games threads */
 	static const char A = 'A';																/* player char for player A - for printing */
 	static const char B = 'B';																/* player char for player B */
 	static const int PLAYERID_A = 0;
@@ -38,27 +54,78 @@ private:
 	size_t maxGamesThreads;
 	bool successfullyCreated;
 	std::string inputDirPath;
-	std::vector<BattleshipBoard> boardsVec;												
+	std::vector<BoardGameTemplate> boardsVec;												/* the valid boards, with everything their games need (built once for every board) */
 	std::vector<PlayerAlgoDetails> algosDetailsVec;
-	std::queue<SingleGameProperties> gamesPropertiesQueue;									/* tournament games queue */
-	std::vector<std::vector<PlayerGameResultData>> allGamesResults;							/* maintains for each player his games results for every round */	
+	std::vector<SingleGameProperties> gamesPropertiesVec;									/* tournament games schedule - immutable once the games threads are running (only appended in streaming mode) */
+	std::atomic<size_t> nextGameIndex;														/* (ATOMIC) index of the next game to play in gamesPropertiesVec - each thread takes its game with fetch_add, without locking */
+	std::vector<std::string> boardsFilenames;												/* streaming mode - the board files, loaded while the games are running */
+	size_t roundsNum;																		/* number of rounds of the scheduled games (grows in streaming mode, guarded by isRoundDoneMutex) */
+	bool isRoundsNumFinal;																	/* true once all the boards are loaded and roundsNum will not grow (guarded by isRoundDoneMutex) */
+	bool isScheduleDone;																	/* true once all the boards are loaded and no new games will be scheduled (guarded by scheduleMutex) */
+	std::vector<std::vector<PlayerGameResultData>> allGamesResults;							/* maintains for each round the games results of every player (released after the round is printed) */	
 	std::vector<std::atomic<int>>playersProgress;											/* maintains for every player in which round he is (atomic, and therefore thread safe) */
 	std::vector<RoundData> allRoundsData;													/* maintains the status for every round in the game, to check if specific round is done */			
 	
-	std::mutex gamesQueueMutex, isRoundDoneMutex;					/* gameQueueMutex - to touch the games queue, isRoundDoneMutex - to know when round is really done */
+	std::mutex isRoundDoneMutex;									/* isRoundDoneMutex - to know when round is really done */
 	std::condition_variable isRoundDoneCondition;					/* to know excactly when round is done and prnt data */
+	std::mutex scheduleMutex;										/* streaming mode - guards the schedule and boardsVec while new boards are added */
+	std::condition_variable newGamesCondition;						/* streaming mode - notifies the games threads that new games were scheduled (or that the schedule is done) */
 	
 	bool printSingleTable;											/* maintins the print method we want */
+	bool roundRobinSchedule;										/* if true, the games are ordered by round robin rounds (every player plays once in each round) */
+	bool reuseAlgoInstances;										/* if true, every thread keeps one instance per player and reuses it in all its games (setPlayer & setBoard are called again) */
+	bool streamingPipeline;											/* if true, the boards are loaded while the games are running, and the games of every valid board are scheduled right away */
+	bool compileBoards;												/* if true, a compiled board (see CompiledBoard) is written next to every valid .sboard that was parsed */
+	bool useValidationCache;										/* if true, the boards validation results are kept in validationCache, and unchanged boards are not checked again */
+	BoardsValidationCache validationCache;
+	bool asyncLogger;												/* if true, the log entries are written by a background thread (see Logger) */
+	bool writeEventLog;												/* if true, the boards, games and threads events are written to eventLog (see EventLog) */
+	EventLog eventLog;
+	int moveTimeBudgetMicros;										/* the time budget of every algo call and of every game, passed to the algos that support it (see SetAlgorithmTimeBudget), 0 is no budget */
+	int gameTimeBudgetMicros;
+	int algoHelperThreadsNum;										/* the helper threads all the algos share besides the games threads (see SetAlgorithmHelperPool), at most the free cores, 0 is none */
+	std::unique_ptr<AlgoHelperPool> algoHelperPool;				/* only while the games run, if there are helper threads */
+	std::vector<std::string> builtinPlayersNames;					/* names of built-in algos (see BuiltinAlgos) that play in addition to the dlls - BUILTIN_PLAYERS key, comma separated */
 
 	std::vector<PlayerGameResultData> allRoundsCumulativeData;		/* for tables printing - data for each player in the tournament for the current round */
 	
 	int TOURNAMENT_MIN_PLAYERS;										/* in order to check if we have enough player for the tournament */
 	LogLevel logLevelVal;
 
-	void createGamesPropertiesQueue();
+	void createGamesPropertiesSchedule();
+
+	/* appends all the games of the given board to the schedule (every 2 players play twice - home and away) */
+	void appendBoardGames(int boardIndex);
+
+	/* appends the games of the given board to the schedule as a round robin (circle method), so every player plays once in each round.
+	 * the first half of the rounds is the home games, and the second half is the same rounds with away games */
+	void appendRoundRobinBoardGames(int boardIndex);
 	
-	/*  takes single game properties from the gamesQueue, run the game and then updae it's results */
-	void singleThreadJob();
+	/*  takes single game properties from the games schedule, run the game and then updae it's results */
+	void singleThreadJob(int threadIndex);
+
+	/* takes the next game of the schedule for the calling thread, returns false if there are no more games to play.
+	 * in streaming mode the thread waits until its game is scheduled, or until all the boards are loaded */
+	bool takeNextGame(const SingleGameProperties*& gameProperties, const BoardGameTemplate*& gameBoard);
+
+	/* streaming mode - loads the boards by the files order while the games are running, and schedules the games of every valid board */
+	void streamTournamentBoards();
+
+	/* writes the boards validation cache (if it is used) after all the boards were loaded */
+	void saveValidationCache();
+
+	/* streaming mode - adds a valid board to boardsVec and schedules its games (the games threads can play them right away) */
+	void publishBoardGames(const std::string& boardFilename, std::unique_ptr<BoardGameTemplate> board);
+
+	/* writes the board_validated event of a board that loadBoard is done with. source is where its validation came from (compiled/cache/parsed) */
+	void writeBoardValidatedEvent(const std::string& boardFilename, bool isValidBoard, const char* source, long long loadStartMicros);
+
+	/* writes the board_added event of the board in boardsVec[boardIndex] to the event log buffer, without flushing it (it is called under scheduleMutex in streaming mode) */
+	void writeBoardAddedEvent(const std::string& boardFilename, int boardIndex);
+
+	/* returns the algo instance of the given player for the next game of this thread.
+	 * in reuse mode, the instance is created only in the first game and stays in threadAlgos for the next games, otherwise a new instance is created for every game */
+	IBattleshipGameAlgo* getThreadAlgoInstance(int playerIndex, std::vector<AlgoInstancePtr>& threadAlgos) const;
 	
 	/* given a single game results, update the data in the data structures */
 	void updateGamesResults(const PlayerGameResultData& currGameRes, int playerIndexA, int playerIndexB);
@@ -67,30 +134,43 @@ private:
 	bool checkTournamentArguments(int argc, char* argv[]);
 	
 	bool checkTournamentBoards();
-	
-	/* given a game main board, returns true if the board is valid according to the game rules */
-	static bool checkBoardValidity(const BattleshipBoard& board);
-	
-	/* given a main board, update the input sets refernces with the valid and invalid ship details [for player A and B] */
-	static void FindValidAndInvalidShipsInBoard(const BattleshipBoard& board, std::set<std::pair<char, std::set<Coordinate>>>& validShips_A, std::set<char>& invalidShips_A, std::set<std::pair<char, std::set<Coordinate>>>& validShips_B, std::set<char>& invalidShips_B);
 
-	/* given a set of sips details for player, this function deletes invalid ships from the set, according to the game rules */
-	/* in addition, adds letters of deleted found invalid ships to the set invalidShips*/
-	static void DeleteInvalidShipsDetailsEntryFromSet(std::set<std::pair<char, std::set<Coordinate>>>& setOfShipsDetails, std::set<char>& invalidShips);
+	/* streaming mode - fills boardsFilenames with the board files in the input dir. the boards are loaded later, by streamTournamentBoards */
+	bool listTournamentBoardsFiles();
+
+	/* loads and checks a single board file. for a valid board, returns its game template, otherwise nullptr.
+	 * an up to date compiled board of the file is preferred, and in COMPILE_BOARDS mode it is written after the file is checked.
+	 * with the validation cache, the validation of a board that was already checked is taken from the cache.
+	 * thread safe - the log messages are added to logEntries and not to the log */
+	std::unique_ptr<BoardGameTemplate> loadBoard(const std::string& currBoardFilename, LogEntries& logEntries);
+	
+	/* given a game main board, returns true if the board is valid according to the game rules.
+	 * for a valid board, shipsDetailsA & shipsDetailsB are updated with the ships of every player */
+	static bool checkBoardValidity(const BattleshipBoard& board, std::vector<ShipDetails>& shipsDetailsA, std::vector<ShipDetails>& shipsDetailsB, LogEntries& logEntries);
 	
 	/* given a player name and set of invalid ships letter for this player , prints relevant error message to the log for each invalid ship in set */
-	static void PrintWrongSizeOrShapeForShips(std::set<char>& invalidShipsSet, char playerChar);
+	static void PrintWrongSizeOrShapeForShips(const std::set<char>& invalidShipsSet, char playerChar, LogEntries& logEntries);
 
-	/* checks if the board is balanced with number and type of the 2 players*/
-	static void comparePlayersShips(std::set<std::pair<char, std::set<Coordinate>>>& validShips_A, std::set<std::pair<char, std::set<Coordinate>>>& validShips_B);
+	/* checks if the board is balanced with number and type of the valid ships of the 2 players*/
+	static void comparePlayersShips(const BoardValidationReport& report, LogEntries& logEntries);
 	
 	/* fills the tournament algos vectors with valid algos from the input dir */
 	bool loadTournamentAlgos();
 	
-	bool loadPlayerDll(const std::string& currDllFilename);
+	/* adds a player to the tournament algos vector for every name in builtinPlayersNames */
+	void loadBuiltinAlgos();
+
+	/* loads a single algo library into currAlgo. thread safe - the log messages are added to logEntries and not to the log */
+	bool loadPlayerDll(const std::string& currDllFilename, PlayerAlgoDetails& currAlgo, LogEntries& logEntries) const;
+
+	/* looks for the optional v2 entry points in the dll of currAlgo, and keeps them only if the dll supports our ALGO_ABI_VERSION */
+	static void loadPlayerDllV2EntryPoints(PlayerAlgoDetails& currAlgo, LogEntries& logEntries);
 
 	void parseDefaultsFromConfigFile();
 	void storeConfigLine(const std::string& key, const std::string& value);
 	void printRouondGameResToLog(int currRound) const;
+
+	/* number of scheduled games that were not taken by a games thread yet - for the log */
+	size_t remainingGamesNum();
 	void printProgramValuesToLog()const;
 };
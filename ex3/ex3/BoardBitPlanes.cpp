@@ -0,0 +1,171 @@
+#include "BoardBitPlanes.h"
+#include "BattleshipBoard.h"
+#include <array>
+#include <cctype>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BOARD_BIT_PLANES_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+	const size_t WORD_BITS = 64;
+	const size_t SIMD_WORDS = 4;																	/* the widest vector we read (AVX2) - for the planes padding */
+
+	/* word w of the plane p, shifted by wordShift words and bitShift bits - cells [64w + shift, 64w + shift + 64) */
+	inline uint64_t shiftedWord(const uint64_t* p, size_t w, size_t wordShift, unsigned bitShift)
+	{
+		if (bitShift == 0) return p[w + wordShift];
+		return (p[w + wordShift] >> bitShift) | (p[w + wordShift + 1] << (WORD_BITS - bitShift));
+	}
+
+#if defined(__AVX2__)
+	inline __m256i shiftedWords(const uint64_t* p, size_t w, size_t wordShift, __m128i rightShift, __m128i leftShift)
+	{
+		auto low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + w + wordShift));
+		auto high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + w + wordShift + 1));
+		return _mm256_or_si256(_mm256_srl_epi64(low, rightShift), _mm256_sll_epi64(high, leftShift));	/* a shift by 64 is 0 */
+	}
+#elif defined(BOARD_BIT_PLANES_SSE2)
+	inline __m128i shiftedWords(const uint64_t* p, size_t w, size_t wordShift, __m128i rightShift, __m128i leftShift)
+	{
+		auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + w + wordShift));
+		auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + w + wordShift + 1));
+		return _mm_or_si128(_mm_srl_epi64(low, rightShift), _mm_sll_epi64(high, leftShift));			/* a shift by 64 is 0 */
+	}
+#endif
+}
+
+BoardBitPlanes::BoardBitPlanes(const BattleshipBoard& board) : rows(board.rows), cols(board.cols), depth(board.depth)
+{
+	static const auto planesTable = []()
+	{
+		std::array<int, 256> table;
+		for (int ch = 0; ch < 256; ch++)
+			table[ch] = planeIndex(static_cast<char>(ch));
+		return table;
+	}();
+
+	const auto& boardVec = board.boardVec;
+	auto cellsNum = boardVec.size();
+	auto maxWordShift = static_cast<size_t>(rows) * cols / WORD_BITS;								/* the longest shift is a whole depth layer */
+	wordsNum = (cellsNum + WORD_BITS - 1) / WORD_BITS;
+	planeStride = wordsNum + maxWordShift + 1 + SIMD_WORDS;
+
+	planes.assign((PLANES_NUM + 1) * planeStride, 0);
+	notLastColMask.assign(wordsNum, 0);
+	notLastRowMask.assign(wordsNum, 0);
+
+	auto allShips = planes.data() + PLANES_NUM * planeStride;
+	size_t cellIndex = 0;
+	for (auto d = 0; d < depth; d++)
+	{
+		for (auto r = 0; r < rows; r++)
+		{
+			for (auto c = 0; c < cols; c++, cellIndex++)
+			{
+				auto word = cellIndex / WORD_BITS;
+				auto bit = uint64_t(1) << (cellIndex % WORD_BITS);
+
+				if (c != cols - 1) notLastColMask[word] |= bit;
+				if (r != rows - 1) notLastRowMask[word] |= bit;
+
+				auto planeIdx = planesTable[static_cast<unsigned char>(boardVec[cellIndex])];
+				if (planeIdx == NO_PLANE) continue;
+
+				planes[planeIdx * planeStride + word] |= bit;
+				allShips[word] |= bit;
+			}
+		}
+	}
+}
+
+bool BoardBitPlanes::hasAdjacentShips() const
+{
+	/* every pair of adjacent cells is checked once - from the cell with the lower index */
+	return hasDifferentShipsAtShift(1, notLastColMask.data()) ||
+		hasDifferentShipsAtShift(cols, notLastRowMask.data()) ||
+		hasDifferentShipsAtShift(static_cast<size_t>(rows) * cols, nullptr);						/* past the last layer the planes are 0 */
+}
+
+bool BoardBitPlanes::hasDifferentShipsAtShift(size_t shift, const uint64_t* validMask) const
+{
+	/* different ships = both cells are ships, and there is no plane that has both of them */
+	auto wordShift = shift / WORD_BITS;
+	auto bitShift = static_cast<unsigned>(shift % WORD_BITS);
+	size_t w = 0;
+
+#if defined(__AVX2__)
+	auto rightShift = _mm_cvtsi32_si128(static_cast<int>(bitShift));
+	auto leftShift = _mm_cvtsi32_si128(static_cast<int>(WORD_BITS - bitShift));
+	auto diff = _mm256_setzero_si256();
+
+	for (; w + 4 <= wordsNum; w += 4)
+	{
+		auto same = _mm256_setzero_si256();
+		for (auto p = 0; p < PLANES_NUM; p++)
+			same = _mm256_or_si256(same, _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(plane(p) + w)), shiftedWords(plane(p), w, wordShift, rightShift, leftShift)));
+
+		auto cellsDiff = _mm256_andnot_si256(same, _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(allShipsPlane() + w)), shiftedWords(allShipsPlane(), w, wordShift, rightShift, leftShift)));
+		if (validMask) cellsDiff = _mm256_and_si256(cellsDiff, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(validMask + w)));
+		diff = _mm256_or_si256(diff, cellsDiff);
+	}
+	if (!_mm256_testz_si256(diff, diff)) return true;
+#elif defined(BOARD_BIT_PLANES_SSE2)
+	auto rightShift = _mm_cvtsi32_si128(static_cast<int>(bitShift));
+	auto leftShift = _mm_cvtsi32_si128(static_cast<int>(WORD_BITS - bitShift));
+	auto diff = _mm_setzero_si128();
+
+	for (; w + 2 <= wordsNum; w += 2)
+	{
+		auto same = _mm_setzero_si128();
+		for (auto p = 0; p < PLANES_NUM; p++)
+			same = _mm_or_si128(same, _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(plane(p) + w)), shiftedWords(plane(p), w, wordShift, rightShift, leftShift)));
+
+		auto cellsDiff = _mm_andnot_si128(same, _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(allShipsPlane() + w)), shiftedWords(allShipsPlane(), w, wordShift, rightShift, leftShift)));
+		if (validMask) cellsDiff = _mm_and_si128(cellsDiff, _mm_loadu_si128(reinterpret_cast<const __m128i*>(validMask + w)));
+		diff = _mm_or_si128(diff, cellsDiff);
+	}
+	if (_mm_movemask_epi8(_mm_cmpeq_epi8(diff, _mm_setzero_si128())) != 0xFFFF) return true;
+#endif
+
+	for (; w < wordsNum; w++)																		/* scalar - the words that are left (or all of them without SIMD) */
+	{
+		uint64_t same = 0;
+		for (auto p = 0; p < PLANES_NUM; p++)
+			same |= plane(p)[w] & shiftedWord(plane(p), w, wordShift, bitShift);
+
+		auto cellsDiff = allShipsPlane()[w] & shiftedWord(allShipsPlane(), w, wordShift, bitShift) & ~same;
+		if (validMask) cellsDiff &= validMask[w];
+		if (cellsDiff) return true;
+	}
+	return false;
+}
+
+int BoardBitPlanes::countPlayerShipCells(int playerId) const
+{
+	int cellsNum = 0;
+	for (auto shipType = 0; shipType < SHIP_TYPES_NUM; shipType++)
+		cellsNum += countShipTypeCells(playerId, shipType);
+	return cellsNum;
+}
+
+int BoardBitPlanes::countShipTypeCells(int playerId, int shipType) const
+{
+	auto shipTypePlane = plane(playerId * SHIP_TYPES_NUM + shipType);
+	int cellsNum = 0;
+	for (size_t w = 0; w < wordsNum; w++)
+		cellsNum += BattleshipGameUtils::popcount(shipTypePlane[w]);
+	return cellsNum;
+}
+
+int BoardBitPlanes::planeIndex(char shipSymbol)
+{
+	auto shipType = BattleshipBoard::shipTypeIndex(shipSymbol);
+	if (shipType < 0) return NO_PLANE;
+
+	return (isupper(static_cast<unsigned char>(shipSymbol)) ? shipType : SHIP_TYPES_NUM + shipType);	/* player A ships are upper case */
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class BattleshipBoard;
+
+/**
+ * \brief bitboard view of a game board - one bit plane for every ship symbol (4 ship types x 2 players) and one for all the ships,
+ * over the flat layout of the board vector (bit i is the cell i, see BattleshipGameUtils::calcCoordIndex).
+ * the board checks are done with shifted AND/OR and popcount over whole planes, 64 cells in a word (with AVX2/SSE2 when the compiler targets them)
+ */
+class BoardBitPlanes
+{
+public:
+	static const int SHIP_TYPES_NUM = 4;
+	static const int PLANES_NUM = 2 * SHIP_TYPES_NUM;												/* player A planes, then player B planes */
+	static const int NO_PLANE = -1;
+
+	/* the board cells must be ship chars or BattleshipBoard::BLANK_CHAR */
+	explicit BoardBitPlanes(const BattleshipBoard& board);
+
+	/* true if there are 2 adjacent cells (up/down, left/right or in depth) with different ship chars.
+	 * the same verdict as checking the nearby coordinates of every ship cell */
+	bool hasAdjacentShips() const;
+
+	/* number of cells of all the ships of the given player / of its ships of the given type (see BattleshipBoard::shipTypeIndex) */
+	int countPlayerShipCells(int playerId) const;
+	int countShipTypeCells(int playerId, int shipType) const;
+
+	/* the plane of the given ship symbol, or NO_PLANE if it is not a ship */
+	static int planeIndex(char shipSymbol);
+
+private:
+	int rows;
+	int cols;
+	int depth;
+	size_t wordsNum;																				/* words in a plane (64 cells in a word) */
+	size_t planeStride;																				/* words in a plane with the padding - the shifted reads may go past the last word */
+	std::vector<uint64_t> planes;																	/* PLANES_NUM planes, then the all ships plane */
+	std::vector<uint64_t> notLastColMask;															/* cells that have a right neighbor (cell + 1) */
+	std::vector<uint64_t> notLastRowMask;															/* cells that have a next row neighbor (cell + cols) */
+
+	const uint64_t* plane(int index) const { return planes.data() + index * planeStride; }
+	const uint64_t* allShipsPlane() const { return plane(PLANES_NUM); }
+
+	/* true if a cell and the cell that is shift cells after it (for a cell in validMask, or any cell if validMask is nullptr) are different ships */
+	bool hasDifferentShipsAtShift(size_t shift, const uint64_t* validMask) const;
+};
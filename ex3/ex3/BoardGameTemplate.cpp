@@ -0,0 +1,22 @@
+#include "BoardGameTemplate.h"
+
+BoardGameTemplate::BoardGameTemplate(BattleshipBoard&& board, const std::vector<ShipDetails>& shipsDetailsA, const std::vector<ShipDetails>& shipsDetailsB) : mainBoard(std::move(board))
+{
+	playersBoards[0] = createPlayerBoard(shipsDetailsA);
+	playersBoards[1] = createPlayerBoard(shipsDetailsB);
+	playersShips[0] = ShipsBoardTemplate(shipsDetailsA, mainBoard.getRows(), mainBoard.getCols(), mainBoard.getDepth());
+	playersShips[1] = ShipsBoardTemplate(shipsDetailsB, mainBoard.getRows(), mainBoard.getCols(), mainBoard.getDepth());
+}
+
+BattleshipBoard BoardGameTemplate::createPlayerBoard(const std::vector<ShipDetails>& shipsDetails) const
+{
+	auto rows = mainBoard.getRows(), cols = mainBoard.getCols(), depth = mainBoard.getDepth();
+	std::vector<char> playerBoardVec(rows * cols * depth, char(BattleshipBoard::BLANK_CHAR));
+
+	for (auto& shipDetails : shipsDetails)
+	{
+		for (auto cellIndex : shipDetails.cellsIndices)
+			playerBoardVec[cellIndex] = shipDetails.symbol;
+	}
+	return BattleshipBoard(std::move(playerBoardVec), rows, cols, depth);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "BattleshipBoard.h"
+#include "ShipsBoard.h"
+
+/**
+ * \brief everything a game needs from its board, built once for every valid board of the tournament (in checkTournamentBoards):
+ * the main board, the view of every player (the main board with only his ships) and the ships table and grid of every player.
+ * the template is not changed after it is built, so all the games on this board (in all the threads) share it,
+ * and every game creates only its own state - the ships hits masks of ShipsBoard
+ */
+class BoardGameTemplate
+{
+public:
+	static const int PLAYERS_NUM = 2;
+
+	BoardGameTemplate() = delete;
+
+	/* shipsDetailsA & shipsDetailsB are the ships of every player in the board, as found when the board was checked */
+	BoardGameTemplate(BattleshipBoard&& board, const std::vector<ShipDetails>& shipsDetailsA, const std::vector<ShipDetails>& shipsDetailsB);
+	~BoardGameTemplate() = default;
+
+	BoardGameTemplate(const BoardGameTemplate& otherTemplate) = delete;							/* deletes copy constructor */
+	BoardGameTemplate& operator=(const BoardGameTemplate& otherTemplate) = delete;				/* deletes copy assignment */
+
+	BoardGameTemplate(BoardGameTemplate&& otherTemplate) noexcept = default;					/* move constructor - only while the boards are loaded, the games keep pointers to the template */
+	BoardGameTemplate& operator=(BoardGameTemplate&& otherTemplate) noexcept = default;
+
+	const BattleshipBoard& getMainBoard() const { return mainBoard; }
+	const BattleshipBoard& getPlayerBoard(int playerId) const { return playersBoards[playerId]; }			/* the main board masked to the ships of this player */
+	const ShipsBoardTemplate& getPlayerShips(int playerId) const { return playersShips[playerId]; }
+
+private:
+
+	BattleshipBoard mainBoard;
+	BattleshipBoard playersBoards[PLAYERS_NUM];
+	ShipsBoardTemplate playersShips[PLAYERS_NUM];
+
+	/* creates an empty board in the size of the main board, with only the given ships */
+	BattleshipBoard createPlayerBoard(const std::vector<ShipDetails>& shipsDetails) const;
+};
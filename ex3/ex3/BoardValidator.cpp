@@ -0,0 +1,86 @@
+#include "BoardValidator.h"
+#include "Ship.h"
+#include "BoardBitPlanes.h"
+#include <algorithm>
+
+BoardValidationReport BoardValidator::validate(const BattleshipBoard& board)
+{
+	BoardValidationReport report;
+	BoardBitPlanes planes(board);
+	report.hasAdjacentShips = planes.hasAdjacentShips();
+	for (auto playerId = 0; playerId < BoardValidationReport::PLAYERS_NUM; playerId++)
+		report.shipsCellsNum[playerId] = planes.countPlayerShipCells(playerId);
+	if (report.shipsCellsNum[0] == 0 || report.shipsCellsNum[1] == 0) return report;			/* a player has no ships at all - no need to collect the ships */
+
+	const auto& boardVec = board.boardVec;
+	std::vector<char> visitedCells(boardVec.size(), false);									/* not vector<bool> - a byte for every cell is faster to access */
+	std::vector<int> cellsStack;																/* shared by all the ships, to allocate it only once */
+	int invalidShipsCellsNum[BoardValidationReport::PLAYERS_NUM][BoardValidationReport::SHIP_TYPES_NUM] = {};
+
+	for (int cellIndex = 0; cellIndex < static_cast<int>(boardVec.size()); cellIndex++)
+	{
+		if (boardVec[cellIndex] == BattleshipBoard::BLANK_CHAR || visitedCells[cellIndex]) continue;
+
+		auto ship = collectShip(board, cellIndex, visitedCells, cellsStack);
+		auto playerId = (BattleshipBoard::isPlayerShip(0, ship.symbol) ? 0 : 1);
+
+		if (Ship::isValidShipDetails(ship)) report.validShips[playerId].push_back(std::move(ship));
+		else
+		{
+			report.invalidShipsChars[playerId].insert(ship.symbol);
+			invalidShipsCellsNum[playerId][BattleshipBoard::shipTypeIndex(ship.symbol)] += static_cast<int>(ship.cellsIndices.size());
+		}
+	}
+
+	/* all the valid ships of a type have the same length - they are counted from the popcount of the type plane, without the cells of the invalid ships */
+	const char shipTypesSymbols[BoardValidationReport::SHIP_TYPES_NUM] = { BattleshipBoard::RUBBER_BOAT, BattleshipBoard::ROCKET_SHIP, BattleshipBoard::SUBMARINE, BattleshipBoard::DESTROYER };
+	for (auto playerId = 0; playerId < BoardValidationReport::PLAYERS_NUM; playerId++)
+	{
+		for (auto shipType = 0; shipType < BoardValidationReport::SHIP_TYPES_NUM; shipType++)
+			report.shipsTypesCount[playerId][shipType] = (planes.countShipTypeCells(playerId, shipType) - invalidShipsCellsNum[playerId][shipType]) / Ship::getShipLen(shipTypesSymbols[shipType]);
+	}
+
+	return report;
+}
+
+ShipDetails BoardValidator::collectShip(const BattleshipBoard& board, int cellIndex, std::vector<char>& visitedCells, std::vector<int>& cellsStack)
+{
+	const auto& boardVec = board.boardVec;
+	const int rows = board.rows, cols = board.cols, depth = board.depth;
+	const int layerSize = rows * cols;
+
+	ShipDetails ship(boardVec[cellIndex], cellIndex, BattleshipGameUtils::calcCoordFromIndex(cellIndex, rows, cols));
+	visitedCells[cellIndex] = true;
+	cellsStack.assign(1, cellIndex);
+
+	while (!cellsStack.empty())
+	{
+		auto currIndex = cellsStack.back();
+		auto currCoord = BattleshipGameUtils::calcCoordFromIndex(currIndex, rows, cols);
+		cellsStack.pop_back();
+
+		ship.minCoord = Coordinate(std::min(ship.minCoord.row, currCoord.row), std::min(ship.minCoord.col, currCoord.col), std::min(ship.minCoord.depth, currCoord.depth));
+		ship.maxCoord = Coordinate(std::max(ship.maxCoord.row, currCoord.row), std::max(ship.maxCoord.col, currCoord.col), std::max(ship.maxCoord.depth, currCoord.depth));
+
+		/* the nearby cells that are in the board - in the order of BattleshipGameUtils::setSixOptionsVector */
+		int nearbyCells[6];
+		int nearbyNum = 0;
+		if (currCoord.col < cols - 1) nearbyCells[nearbyNum++] = currIndex + 1;
+		if (currCoord.col > 0) nearbyCells[nearbyNum++] = currIndex - 1;
+		if (currCoord.row > 0) nearbyCells[nearbyNum++] = currIndex - cols;
+		if (currCoord.row < rows - 1) nearbyCells[nearbyNum++] = currIndex + cols;
+		if (currCoord.depth > 0) nearbyCells[nearbyNum++] = currIndex - layerSize;
+		if (currCoord.depth < depth - 1) nearbyCells[nearbyNum++] = currIndex + layerSize;
+
+		for (auto i = 0; i < nearbyNum; i++)
+		{
+			auto nextIndex = nearbyCells[i];
+			if (boardVec[nextIndex] != ship.symbol || visitedCells[nextIndex]) continue;		/* blank, another ship (see BoardBitPlanes::hasAdjacentShips) or collected */
+
+			visitedCells[nextIndex] = true;
+			cellsStack.push_back(nextIndex);
+			ship.cellsIndices.push_back(nextIndex);
+		}
+	}
+	return ship;
+}
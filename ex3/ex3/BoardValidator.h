@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+#include <set>
+#include "BattleshipBoard.h"
+
+/* the result of a board validation (see BoardValidator) - everything the log messages and the board games setup need */
+
+struct BoardValidationReport
+{
+	static const int PLAYERS_NUM = 2;
+	static const int SHIP_TYPES_NUM = 4;
+
+	std::vector<ShipDetails> validShips[PLAYERS_NUM];											/* the ships with valid size and shape of every player */
+	std::set<char> invalidShipsChars[PLAYERS_NUM];												/* the chars of the ships with wrong size or shape (sorted, each char once) */
+	int shipsTypesCount[PLAYERS_NUM][SHIP_TYPES_NUM] = {};										/* number of valid ships of every type (see BattleshipBoard::shipTypeIndex), 0 if a player has no ships cells */
+	int shipsCellsNum[PLAYERS_NUM] = {};														/* number of ships cells of every player (valid ships or not) */
+	bool hasAdjacentShips = false;
+
+	bool hasValidShips() const { return !validShips[0].empty() && !validShips[1].empty(); }
+	bool hasInvalidShips() const { return !invalidShipsChars[0].empty() || !invalidShipsChars[1].empty(); }
+	bool isValid() const { return hasValidShips() && !hasInvalidShips() && !hasAdjacentShips; }
+};
+
+/**
+ * \brief validates a game board in 2 walks over the board vector, and word-wise kernels over the bit planes of the board (see BoardBitPlanes):
+ *		1. the bit planes are built from the board vector
+ *		2. the adjacent ships and the ships cells of every player and type are checked on the planes (shifted AND/OR and popcount)
+ *		3. every ship is collected once (flood fill) in a single walk over the board vector, and its size and shape are checked.
+ *		   the ships of every type are counted from the popcounts of step 2, without the cells of the invalid ships
+ * the old checks walked the board (or a copy of it) once for every check, and allocated a set of coordinates for every ship cell
+ */
+class BoardValidator
+{
+public:
+	/* @assume - the board was successfully created */
+	static BoardValidationReport validate(const BattleshipBoard& board);
+
+private:
+	BoardValidator() = delete;
+
+	/* collects the ship that contains the given cell, and marks its cells as visited */
+	static ShipDetails collectShip(const BattleshipBoard& board, int cellIndex, std::vector<char>& visitedCells, std::vector<int>& cellsStack);
+};
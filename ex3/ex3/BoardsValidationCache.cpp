@@ -0,0 +1,173 @@
+#include "BoardsValidationCache.h"
+#include "CompiledBoard.h"
+#include "MappedFile.h"
+#include <fstream>
+
+const std::string BoardsValidationCache::CACHE_FILENAME("boards_validation.cache");
+const char BoardsValidationCache::MAGIC[8] = { 'S', 'B', 'V', 'C', 'A', 'C', 'H', 'E' };
+
+/* cache file layout (native byte order):
+ *		magic, version, number of entries (uint32)
+ *		for every entry:	content hash, content size (uint64), isValid, rows, cols, depth (int32), number of log messages (uint32),
+ *							every message - level (int32), length (uint32) and chars,
+ *							number of ships of player A and B (uint32) and their records (see CompiledBoard::writePlayerShips) */
+
+void BoardsValidationCache::Entry::setBoard(const BattleshipBoard& board)
+{
+	rows = (board.isSuccessfullyCreated() ? board.getRows() : 0);
+	cols = (board.isSuccessfullyCreated() ? board.getCols() : 0);
+	depth = (board.isSuccessfullyCreated() ? board.getDepth() : 0);
+}
+
+bool BoardsValidationCache::Entry::isOfBoard(const BattleshipBoard& board) const
+{
+	Entry boardEntry;
+	boardEntry.setBoard(board);
+	return rows == boardEntry.rows && cols == boardEntry.cols && depth == boardEntry.depth;
+}
+
+void BoardsValidationCache::load(const std::string& cacheFilePath)
+{
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	entries.clear();
+	isChanged = false;
+
+	MappedFile cacheFile(cacheFilePath);
+	if (!cacheFile.isOpen()) return;														/* no cache yet */
+
+	const char* filePos = cacheFile.data();
+	const char* fileEnd = filePos + cacheFile.size();
+	char magic[sizeof(MAGIC)];
+	uint32_t version, entriesNum;
+
+	if (!CompiledBoard::readValue(filePos, fileEnd, magic) || memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) return;
+	if (!CompiledBoard::readValue(filePos, fileEnd, version) || version != FORMAT_VERSION || !CompiledBoard::readValue(filePos, fileEnd, entriesNum)) return;
+
+	for (uint32_t i = 0; i < entriesNum; i++)
+	{
+		uint64_t contentHash;
+		CachedEntry cachedEntry;
+		if (!readEntry(filePos, fileEnd, contentHash, cachedEntry))
+		{
+			entries.clear();																/* corrupted cache - we will build it again */
+			return;
+		}
+		entries[contentHash] = std::move(cachedEntry);
+	}
+}
+
+bool BoardsValidationCache::save(const std::string& cacheFilePath)
+{
+	std::lock_guard<std::mutex> lock(cacheMutex);
+
+	for (const auto& hashAndEntry : entries)												/* entries of boards that are not in the tournament anymore are removed */
+		isChanged = isChanged || !hashAndEntry.second.isUsed;
+	if (!isChanged) return true;
+
+	std::vector<char> fileContent(MAGIC, MAGIC + sizeof(MAGIC));
+	uint32_t usedEntriesNum = 0;
+	for (const auto& hashAndEntry : entries)
+		usedEntriesNum += hashAndEntry.second.isUsed;
+
+	CompiledBoard::appendValue(fileContent, uint32_t(FORMAT_VERSION));
+	CompiledBoard::appendValue(fileContent, usedEntriesNum);
+	for (const auto& hashAndEntry : entries)
+	{
+		if (hashAndEntry.second.isUsed)
+			writeEntry(fileContent, hashAndEntry.first, hashAndEntry.second);
+	}
+
+	std::ofstream cacheFile(cacheFilePath, std::ios::binary | std::ios::trunc);
+	if (!cacheFile.is_open()) return false;
+
+	cacheFile.write(fileContent.data(), fileContent.size());
+	isChanged = false;
+	return cacheFile.good();
+}
+
+bool BoardsValidationCache::find(uint64_t contentHash, uint64_t contentSize, Entry& entry)
+{
+	std::lock_guard<std::mutex> lock(cacheMutex);
+
+	auto cachedEntryItr = entries.find(contentHash);
+	if (cachedEntryItr == entries.end() || cachedEntryItr->second.contentSize != contentSize) return false;
+
+	cachedEntryItr->second.isUsed = true;
+	entry = cachedEntryItr->second.entry;
+	return true;
+}
+
+void BoardsValidationCache::insert(uint64_t contentHash, uint64_t contentSize, Entry entry)
+{
+	std::lock_guard<std::mutex> lock(cacheMutex);
+
+	entries[contentHash] = CachedEntry{ contentSize, true, std::move(entry) };
+	isChanged = true;
+}
+
+void BoardsValidationCache::touch(uint64_t contentHash, uint64_t contentSize)
+{
+	std::lock_guard<std::mutex> lock(cacheMutex);
+
+	auto cachedEntryItr = entries.find(contentHash);
+	if (cachedEntryItr != entries.end() && cachedEntryItr->second.contentSize == contentSize)
+		cachedEntryItr->second.isUsed = true;
+}
+
+void BoardsValidationCache::writeEntry(std::vector<char>& fileContent, uint64_t contentHash, const CachedEntry& cachedEntry)
+{
+	const auto& entry = cachedEntry.entry;
+
+	CompiledBoard::appendValue(fileContent, contentHash);
+	CompiledBoard::appendValue(fileContent, cachedEntry.contentSize);
+	CompiledBoard::appendValue(fileContent, static_cast<int32_t>(entry.isValid));
+	CompiledBoard::appendValue(fileContent, static_cast<int32_t>(entry.rows));
+	CompiledBoard::appendValue(fileContent, static_cast<int32_t>(entry.cols));
+	CompiledBoard::appendValue(fileContent, static_cast<int32_t>(entry.depth));
+
+	CompiledBoard::appendValue(fileContent, static_cast<uint32_t>(entry.validationLogs.size()));
+	for (const auto& logEntry : entry.validationLogs)
+	{
+		CompiledBoard::appendValue(fileContent, static_cast<int32_t>(logEntry.second));
+		CompiledBoard::appendValue(fileContent, static_cast<uint32_t>(logEntry.first.size()));
+		fileContent.insert(fileContent.end(), logEntry.first.begin(), logEntry.first.end());
+	}
+
+	CompiledBoard::appendValue(fileContent, static_cast<uint32_t>(entry.shipsDetailsA.size()));
+	CompiledBoard::appendValue(fileContent, static_cast<uint32_t>(entry.shipsDetailsB.size()));
+	CompiledBoard::writePlayerShips(fileContent, entry.shipsDetailsA);
+	CompiledBoard::writePlayerShips(fileContent, entry.shipsDetailsB);
+}
+
+bool BoardsValidationCache::readEntry(const char*& filePos, const char* fileEnd, uint64_t& contentHash, CachedEntry& cachedEntry)
+{
+	auto& entry = cachedEntry.entry;
+	int32_t isValid, rows, cols, depth;
+	uint32_t logsNum, shipsNumA, shipsNumB;
+
+	cachedEntry.isUsed = false;
+	if (!CompiledBoard::readValue(filePos, fileEnd, contentHash) || !CompiledBoard::readValue(filePos, fileEnd, cachedEntry.contentSize) ||
+		!CompiledBoard::readValue(filePos, fileEnd, isValid) || !CompiledBoard::readValue(filePos, fileEnd, rows) ||
+		!CompiledBoard::readValue(filePos, fileEnd, cols) || !CompiledBoard::readValue(filePos, fileEnd, depth) ||
+		!CompiledBoard::readValue(filePos, fileEnd, logsNum) || rows < 0 || cols < 0 || depth < 0) return false;
+
+	entry.isValid = (isValid != 0);
+	entry.rows = rows;
+	entry.cols = cols;
+	entry.depth = depth;
+
+	for (uint32_t i = 0; i < logsNum; i++)
+	{
+		int32_t level;
+		uint32_t msgLen;
+		if (!CompiledBoard::readValue(filePos, fileEnd, level) || !CompiledBoard::readValue(filePos, fileEnd, msgLen)) return false;
+		if (level < Error || level > Debug || static_cast<size_t>(fileEnd - filePos) < msgLen) return false;
+
+		entry.validationLogs.emplace_back(std::string(filePos, msgLen), static_cast<LogLevel>(level));
+		filePos += msgLen;
+	}
+
+	return CompiledBoard::readValue(filePos, fileEnd, shipsNumA) && CompiledBoard::readValue(filePos, fileEnd, shipsNumB) &&
+		CompiledBoard::readPlayerShips(filePos, fileEnd, shipsNumA, rows, cols, depth, entry.shipsDetailsA) &&
+		CompiledBoard::readPlayerShips(filePos, fileEnd, shipsNumB, rows, cols, depth, entry.shipsDetailsB);
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
+#include "BattleshipBoard.h"
+#include "Logger.h"
+
+/**
+ * \brief on-disk cache of the boards validation results, keyed by the board file content (hash and size).
+ * for every board content we keep the verdict of the validation, the messages it logged, and the ships of the players (for a valid board),
+ * so an unchanged board is not checked again in the next tournaments.
+ * thread safe - the boards are checked in parallel
+ */
+class BoardsValidationCache
+{
+public:
+	static const std::string CACHE_FILENAME;
+
+	struct Entry
+	{
+		bool isValid = false;
+		int rows = 0;																		/* the board dimensions (0 if the board could not be created) */
+		int cols = 0;
+		int depth = 0;
+		LogEntries validationLogs;															/* the messages the validation added to the log */
+		std::vector<ShipDetails> shipsDetailsA;												/* valid board only - the ships of every player */
+		std::vector<ShipDetails> shipsDetailsB;
+
+		/* the dimensions of the given board (0 if it could not be created) / true if the entry has them */
+		void setBoard(const BattleshipBoard& board);
+		bool isOfBoard(const BattleshipBoard& board) const;
+	};
+
+	BoardsValidationCache() : isChanged(false) {}
+
+	BoardsValidationCache(const BoardsValidationCache& otherCache) = delete;				/* deletes copy constructor */
+	BoardsValidationCache& operator=(const BoardsValidationCache& otherCache) = delete;		/* deletes copy assignment */
+
+	/* reads the cache file. a missing or corrupted file is an empty cache */
+	void load(const std::string& cacheFilePath);
+
+	/* writes the cache file, if the cache was changed since it was loaded. only the boards that were looked up, touched or added are kept */
+	bool save(const std::string& cacheFilePath);
+
+	/* if the validation result of the given content is in the cache, copies it to entry and returns true */
+	bool find(uint64_t contentHash, uint64_t contentSize, Entry& entry);
+
+	void insert(uint64_t contentHash, uint64_t contentSize, Entry entry);
+
+	/* marks the entry of the given content as used in this tournament (so save() keeps it), for boards that were loaded without find() - from their compiled board */
+	void touch(uint64_t contentHash, uint64_t contentSize);
+
+private:
+
+	static const char MAGIC[8];
+	static const uint32_t FORMAT_VERSION = 3;											/* 2 - the ship types balance message (entries of version 1 may miss it), 3 - board dimensions, ship records without a bounding box */
+
+	struct CachedEntry
+	{
+		uint64_t contentSize;
+		bool isUsed;																		/* looked up (or added) in this tournament */
+		Entry entry;
+	};
+
+	std::unordered_map<uint64_t, CachedEntry> entries;										/* content hash -> validation result */
+	bool isChanged;
+	std::mutex cacheMutex;
+
+	static void writeEntry(std::vector<char>& fileContent, uint64_t contentHash, const CachedEntry& cachedEntry);
+	static bool readEntry(const char*& filePos, const char* fileEnd, uint64_t& contentHash, CachedEntry& cachedEntry);
+};
@@ -0,0 +1,122 @@
+#include "BuiltinAlgos.h"
+#include "BattleshipGameManager.h"
+#include "PlayerSmart.h"
+#include <vector>
+#include <initializer_list>
+
+/* the built-in algos entries - the algo type, its name as written in BUILTIN_PLAYERS, and how to create an instance of it */
+struct SmartAlgoEntry
+{
+	typedef PlayerSmart Algo;
+	static const char* name() { return "smart"; }
+	static Algo* create() { return new PlayerSmart(); }
+};
+
+struct SmartDensityAlgoEntry
+{
+	typedef PlayerSmart Algo;
+	static const char* name() { return "smart_density"; }
+	static Algo* create() { return new PlayerSmart(PlayerSmart::TargetingMode::Density); }
+};
+
+struct SmartSamplingAlgoEntry
+{
+	typedef PlayerSmart Algo;
+	static const char* name() { return "smart_sampling"; }
+	static Algo* create() { return new PlayerSmart(PlayerSmart::TargetingMode::Sampling); }
+};
+
+typedef IBattleshipGameAlgo* (*CreateBuiltinAlgoFuncType)();
+typedef void(*ResetBuiltinAlgoFuncType)(IBattleshipGameAlgo*);
+typedef void(*SetBuiltinAlgoTimeBudgetFuncType)(IBattleshipGameAlgo*, int, int);
+typedef void(*SetBuiltinAlgoHelperPoolFuncType)(IBattleshipGameAlgo*, IAlgoHelperPool*);
+typedef PlayerGameResultData(*RunBuiltinGameFuncType)(BattleshipGameManager&);
+
+template <typename Entry>
+static IBattleshipGameAlgo* createBuiltinAlgo() { return Entry::create(); }
+
+template <typename Algo>
+static void resetBuiltinAlgo(IBattleshipGameAlgo* algo) { static_cast<Algo*>(algo)->reset(); }
+
+template <typename Algo>
+static void setBuiltinAlgoTimeBudget(IBattleshipGameAlgo* algo, int moveBudgetMicros, int gameBudgetMicros) { static_cast<Algo*>(algo)->setTimeBudget(moveBudgetMicros, gameBudgetMicros); }
+
+template <typename Algo>
+static void setBuiltinAlgoHelperPool(IBattleshipGameAlgo* algo, IAlgoHelperPool* helperPool) { static_cast<Algo*>(algo)->setHelperPool(helperPool); }
+
+template <typename AlgoA, typename AlgoB>
+static PlayerGameResultData runBuiltinGame(BattleshipGameManager& game) { return game.Run<AlgoA, AlgoB>(); }
+
+/**
+ * \brief the tables of the built-in algos, generated at compile time from the algos entries.
+ * runFuncs has a Run<AlgoA, AlgoB> instance for every pair of built-in algos: runFuncs[indexA * algosNum + indexB]
+ */
+template <typename... Entries>
+struct BuiltinAlgosTables
+{
+	std::vector<std::string> names{ Entries::name()... };
+	std::vector<CreateBuiltinAlgoFuncType> createFuncs{ &createBuiltinAlgo<Entries>... };
+	std::vector<ResetBuiltinAlgoFuncType> resetFuncs{ &resetBuiltinAlgo<typename Entries::Algo>... };
+	std::vector<SetBuiltinAlgoTimeBudgetFuncType> setTimeBudgetFuncs{ &setBuiltinAlgoTimeBudget<typename Entries::Algo>... };
+	std::vector<SetBuiltinAlgoHelperPoolFuncType> setHelperPoolFuncs{ &setBuiltinAlgoHelperPool<typename Entries::Algo>... };
+	std::vector<RunBuiltinGameFuncType> runFuncs;
+
+	BuiltinAlgosTables() { (void)std::initializer_list<int>{ (appendRunFuncsRow<Entries>(), 0)... }; }
+
+	template <typename EntryA>
+	void appendRunFuncsRow() { for (auto runFunc : { &runBuiltinGame<typename EntryA::Algo, typename Entries::Algo>... }) runFuncs.push_back(runFunc); }
+};
+
+/* the built-in algos list - every algo here must be final (so its calls are not virtual), have reset() that keeps the way it was created, and have setTimeBudget() and setHelperPool() */
+typedef BuiltinAlgosTables<SmartAlgoEntry, SmartDensityAlgoEntry, SmartSamplingAlgoEntry> BuiltinAlgosTablesType;
+
+static const BuiltinAlgosTablesType& builtinAlgosTables()
+{
+	static const BuiltinAlgosTablesType tables;
+	return tables;
+}
+
+size_t BuiltinAlgos::algosNum()
+{
+	return builtinAlgosTables().names.size();
+}
+
+std::string BuiltinAlgos::algoName(int algoIndex)
+{
+	return builtinAlgosTables().names[algoIndex];
+}
+
+int BuiltinAlgos::findAlgoIndex(const std::string& algoName)
+{
+	const auto& names = builtinAlgosTables().names;
+	for (size_t i = 0; i < names.size(); i++)
+	{
+		if (names[i] == algoName) return static_cast<int>(i);
+	}
+	return UNDEFINED_ALGO_INDEX;
+}
+
+IBattleshipGameAlgo* BuiltinAlgos::createAlgo(int algoIndex)
+{
+	return builtinAlgosTables().createFuncs[algoIndex]();
+}
+
+void BuiltinAlgos::resetAlgo(int algoIndex, IBattleshipGameAlgo* algo)
+{
+	builtinAlgosTables().resetFuncs[algoIndex](algo);
+}
+
+void BuiltinAlgos::setTimeBudget(int algoIndex, IBattleshipGameAlgo* algo, int moveBudgetMicros, int gameBudgetMicros)
+{
+	builtinAlgosTables().setTimeBudgetFuncs[algoIndex](algo, moveBudgetMicros, gameBudgetMicros);
+}
+
+void BuiltinAlgos::setHelperPool(int algoIndex, IBattleshipGameAlgo* algo, IAlgoHelperPool* helperPool)
+{
+	builtinAlgosTables().setHelperPoolFuncs[algoIndex](algo, helperPool);
+}
+
+PlayerGameResultData BuiltinAlgos::runGame(int algoIndexA, int algoIndexB, BattleshipGameManager& game)
+{
+	return builtinAlgosTables().runFuncs[algoIndexA * algosNum() + algoIndexB](game);
+}
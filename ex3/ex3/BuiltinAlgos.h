@@ -0,0 +1,32 @@
+#pragma once
+
+#include "IBattleshipGameAlgo.h"
+#include "PlayerGameResultData.h"
+#include <string>
+
+class BattleshipGameManager;
+
+/**
+ * \brief registry of the algos that are compiled into the tournament exe (no dll is needed for them).
+ * the tournament selects them by name (BUILTIN_PLAYERS key in the config file). a game between two built-in algos
+ * runs with BattleshipGameManager::Run<AlgoA, AlgoB>, so the attack() and notifyOnAttackResult() calls are direct calls that can be inlined.
+ * the algos list itself is in BuiltinAlgos.cpp
+ */
+class BuiltinAlgos
+{
+public:
+	static const int UNDEFINED_ALGO_INDEX = -1;
+
+	BuiltinAlgos() = delete;
+
+	static size_t algosNum();
+	static std::string algoName(int algoIndex);
+	static int findAlgoIndex(const std::string& algoName);							/* returns UNDEFINED_ALGO_INDEX if there is no built-in algo with this name */
+	static IBattleshipGameAlgo* createAlgo(int algoIndex);							/* returns new instance - the caller owns it */
+	static void resetAlgo(int algoIndex, IBattleshipGameAlgo* algo);				/* clears the state of an instance before it is reused in a new game */
+	static void setTimeBudget(int algoIndex, IBattleshipGameAlgo* algo, int moveBudgetMicros, int gameBudgetMicros);	/* see SetAlgorithmTimeBudget in IBattleshipGameAlgo.h */
+	static void setHelperPool(int algoIndex, IBattleshipGameAlgo* algo, IAlgoHelperPool* helperPool);				/* see SetAlgorithmHelperPool in IBattleshipGameAlgo.h */
+
+	/* runs the game, when playerA algo was created with createAlgo(algoIndexA) and playerB algo with createAlgo(algoIndexB) */
+	static PlayerGameResultData runGame(int algoIndexA, int algoIndexB, BattleshipGameManager& game);
+};
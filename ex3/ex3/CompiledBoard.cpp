@@ -0,0 +1,154 @@
+#include "CompiledBoard.h"
+#include "MappedFile.h"
+#include "BattleshipGameUtils.h"
+#include "Ship.h"
+#include "ShipsBoard.h"
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+
+const std::string CompiledBoard::COMPILED_BOARD_EXTENSION(".sboardb");
+const char CompiledBoard::MAGIC[8] = { 'S', 'B', 'O', 'A', 'R', 'D', 'B', '\0' };
+
+std::string CompiledBoard::getCompiledBoardPath(const std::string& boardPath)
+{
+	auto extensionPos = boardPath.rfind('.');
+	return (extensionPos == std::string::npos ? boardPath : boardPath.substr(0, extensionPos)) + COMPILED_BOARD_EXTENSION;
+}
+
+bool CompiledBoard::write(const std::string& compiledPath, const std::string& boardPath, const BattleshipBoard& board, const std::vector<ShipDetails>& shipsDetailsA, const std::vector<ShipDetails>& shipsDetailsB)
+{
+	FileHeader header;
+	if (!BattleshipGameUtils::hashFileContent(boardPath, header.sourceHash, header.sourceSize)) return false;
+
+	memcpy(header.magic, MAGIC, sizeof(MAGIC));
+	header.version = FORMAT_VERSION;
+	header.rows = board.getRows();
+	header.cols = board.getCols();
+	header.depth = board.getDepth();
+	header.shipsNum[0] = static_cast<uint32_t>(shipsDetailsA.size());
+	header.shipsNum[1] = static_cast<uint32_t>(shipsDetailsB.size());
+
+	/* the whole file is built in memory and written at once */
+	size_t cellsNum = static_cast<size_t>(header.rows) * header.cols * header.depth;
+	std::vector<char> fileContent(sizeof(FileHeader) + cellsBytes(cellsNum), 0);
+	memcpy(fileContent.data(), &header, sizeof(FileHeader));
+
+	auto cellsPos = fileContent.begin() + sizeof(FileHeader);
+	for (auto d = 0; d < header.depth; d++)										/* by board vector order */
+	{
+		for (auto r = 0; r < header.rows; r++)
+		{
+			for (auto c = 0; c < header.cols; c++)
+				*(cellsPos++) = board(r, c, d);
+		}
+	}
+
+	writePlayerShips(fileContent, shipsDetailsA);
+	writePlayerShips(fileContent, shipsDetailsB);
+
+	std::ofstream compiledFile(compiledPath, std::ios::binary | std::ios::trunc);
+	if (!compiledFile.is_open()) return false;
+
+	compiledFile.write(fileContent.data(), fileContent.size());
+	return compiledFile.good();
+}
+
+void CompiledBoard::writePlayerShips(std::vector<char>& fileContent, const std::vector<ShipDetails>& shipsDetails)
+{
+	for (const auto& shipDetails : shipsDetails)
+	{
+		ShipRecord record = { shipDetails.symbol, static_cast<int32_t>(shipDetails.cellsIndices.size()) };
+		appendValue(fileContent, record);
+
+		for (auto cellIndex : shipDetails.cellsIndices)
+			appendValue(fileContent, static_cast<int32_t>(cellIndex));
+	}
+}
+
+bool CompiledBoard::load(const std::string& compiledPath, const std::string& boardPath, BattleshipBoard& board, std::vector<ShipDetails>& shipsDetailsA, std::vector<ShipDetails>& shipsDetailsB,
+	uint64_t& sourceHash, uint64_t& sourceSize)
+{
+	MappedFile compiledFile(compiledPath);
+	if (!compiledFile.isOpen()) return false;												/* there is no compiled board */
+
+	const char* filePos = compiledFile.data();
+	const char* fileEnd = filePos + compiledFile.size();
+	FileHeader header;
+
+	if (!readValue(filePos, fileEnd, header) || memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != FORMAT_VERSION) return false;
+	if (header.rows < 1 || header.cols < 1 || header.depth < 1) return false;
+
+	/* the compiled board is up to date only if it was compiled from the current .sboard content */
+	if (!BattleshipGameUtils::hashFileContent(boardPath, sourceHash, sourceSize) || sourceHash != header.sourceHash || sourceSize != header.sourceSize) return false;
+
+	auto cellsNum = static_cast<size_t>(header.rows) * header.cols * header.depth;
+	if (static_cast<size_t>(fileEnd - filePos) < cellsBytes(cellsNum)) return false;
+
+	const char* cells = filePos;
+	filePos += cellsBytes(cellsNum);
+
+	std::vector<ShipDetails> shipsA, shipsB;
+	if (!readPlayerShips(filePos, fileEnd, header.shipsNum[0], header.rows, header.cols, header.depth, shipsA) ||
+		!readPlayerShips(filePos, fileEnd, header.shipsNum[1], header.rows, header.cols, header.depth, shipsB) || filePos != fileEnd) return false;
+
+	/* the cells are not covered by the source hash - every ship cell must have the ship symbol and belong to a single ship, and there are no other non blank cells */
+	std::vector<char> shipsCells(cellsNum, false);
+	size_t shipsCellsNum = 0;
+	for (const auto* playerShips : { &shipsA, &shipsB })
+	{
+		for (const auto& shipDetails : *playerShips)
+		{
+			for (auto cellIndex : shipDetails.cellsIndices)
+			{
+				if (cells[cellIndex] != shipDetails.symbol || shipsCells[cellIndex]) return false;
+				shipsCells[cellIndex] = true;
+				shipsCellsNum++;
+			}
+		}
+	}
+	if (static_cast<size_t>(std::count_if(cells, cells + cellsNum, [](char cell) { return cell != BattleshipBoard::BLANK_CHAR; })) != shipsCellsNum) return false;
+
+	board = BattleshipBoard(std::vector<char>(cells, cells + cellsNum), header.rows, header.cols, header.depth);
+	shipsDetailsA = std::move(shipsA);
+	shipsDetailsB = std::move(shipsB);
+	return true;
+}
+
+bool CompiledBoard::readPlayerShips(const char*& filePos, const char* fileEnd, uint32_t shipsNum, int rows, int cols, int depth, std::vector<ShipDetails>& shipsDetails)
+{
+	/* the ships number is checked before any allocation - a corrupted number must not allocate more than the file can hold */
+	if (shipsNum > ShipsBoardTemplate::MAX_SHIPS_NUM || shipsNum > static_cast<size_t>(fileEnd - filePos) / sizeof(ShipRecord)) return false;
+	auto cellsNum = static_cast<long long>(rows) * cols * depth;
+	shipsDetails.reserve(shipsNum);
+
+	for (uint32_t i = 0; i < shipsNum; i++)
+	{
+		ShipRecord record;
+		if (!readValue(filePos, fileEnd, record) || record.symbol != static_cast<char>(record.symbol) || record.cellsNum < 1 || record.cellsNum > ShipsBoardTemplate::MAX_SHIP_PARTS) return false;
+
+		std::vector<int> cellsIndices(record.cellsNum);
+		for (auto& cellIndex : cellsIndices)
+		{
+			int32_t index;
+			if (!readValue(filePos, fileEnd, index) || index < 0 || index >= cellsNum) return false;
+			cellIndex = index;
+		}
+
+		/* the bounding box is built from the cells (it is not kept in the file), and the cells must be distinct - so a valid ship fills its box */
+		ShipDetails shipDetails(static_cast<char>(record.symbol), cellsIndices[0], BattleshipGameUtils::calcCoordFromIndex(cellsIndices[0], rows, cols));
+		for (auto j = 1; j < record.cellsNum; j++)
+		{
+			if (std::find(cellsIndices.begin(), cellsIndices.begin() + j, cellsIndices[j]) != cellsIndices.begin() + j) return false;
+
+			auto cellCoord = BattleshipGameUtils::calcCoordFromIndex(cellsIndices[j], rows, cols);
+			shipDetails.minCoord = Coordinate(std::min(shipDetails.minCoord.row, cellCoord.row), std::min(shipDetails.minCoord.col, cellCoord.col), std::min(shipDetails.minCoord.depth, cellCoord.depth));
+			shipDetails.maxCoord = Coordinate(std::max(shipDetails.maxCoord.row, cellCoord.row), std::max(shipDetails.maxCoord.col, cellCoord.col), std::max(shipDetails.maxCoord.depth, cellCoord.depth));
+		}
+		shipDetails.cellsIndices = std::move(cellsIndices);
+
+		if (!Ship::isValidShipDetails(shipDetails)) return false;								/* a stale or corrupted record - the ships masks assume valid ships */
+		shipsDetails.push_back(std::move(shipDetails));
+	}
+	return true;
+}
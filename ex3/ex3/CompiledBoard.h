@@ -0,0 +1,93 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include "BattleshipBoard.h"
+
+/**
+ * \brief the compiled board format (.sboardb) - a board that was already parsed and validated, together with the ships of both players.
+ * loading it is a single mmap and a copy of the cells - there is no parsing, no ships extraction and no validation.
+ *
+ * file layout (native byte order):
+ *		FileHeader							magic, version, dimensions, number of ships of every player, size and hash of the source .sboard
+ *		cells								rows*cols*depth chars in board vector order (see BattleshipGameUtils::calcCoordIndex), padded to 4 bytes
+ *		ships of player A, then B			for every ship - ShipRecord, followed by the indices of its cells (int32 each). the bounding box is built from the cells
+ *
+ * the compiled board is used only if the hash of its source is the hash of the current .sboard file, otherwise the .sboard is parsed again
+ */
+class CompiledBoard
+{
+public:
+	static const std::string COMPILED_BOARD_EXTENSION;
+
+	/* returns the path of the compiled board of the given .sboard file */
+	static std::string getCompiledBoardPath(const std::string& boardPath);
+
+	/* writes the compiled board of a valid board (and its players ships) to compiledPath. the hash of boardPath content is kept in the file */
+	static bool write(const std::string& compiledPath, const std::string& boardPath, const BattleshipBoard& board, const std::vector<ShipDetails>& shipsDetailsA, const std::vector<ShipDetails>& shipsDetailsB);
+
+	/* loads the compiled board in compiledPath to board, shipsDetailsA & shipsDetailsB, and the hash and size of boardPath content to sourceHash & sourceSize.
+	 * returns false if there is no such file, if it is corrupted, or if it is not up to date with the content of boardPath */
+	static bool load(const std::string& compiledPath, const std::string& boardPath, BattleshipBoard& board, std::vector<ShipDetails>& shipsDetailsA, std::vector<ShipDetails>& shipsDetailsB,
+		uint64_t& sourceHash, uint64_t& sourceSize);
+
+	/* ships tables serialization - appends the ships records to fileContent / reads shipsNum ships records of a rows x cols x depth board
+	 * (returns false if the data is corrupted, or a record is not a valid ship). also used by the boards validation cache */
+	static void writePlayerShips(std::vector<char>& fileContent, const std::vector<ShipDetails>& shipsDetails);
+	static bool readPlayerShips(const char*& filePos, const char* fileEnd, uint32_t shipsNum, int rows, int cols, int depth, std::vector<ShipDetails>& shipsDetails);
+
+	/* copies sizeof(T) bytes from filePos to value and advances filePos. returns false if there are not enough bytes left (corrupted file) */
+	template<typename T>
+	static bool readValue(const char*& filePos, const char* fileEnd, T& value);
+
+	/* appends the bytes of value to fileContent */
+	template<typename T>
+	static void appendValue(std::vector<char>& fileContent, const T& value);
+
+private:
+
+	static const char MAGIC[8];
+	static const uint32_t FORMAT_VERSION = 2;											/* 2 - the ship records have no bounding box (files of version 1 are compiled again) */
+	static const int PLAYERS_NUM = 2;
+
+	struct FileHeader
+	{
+		char magic[8];
+		uint32_t version;
+		int32_t rows;
+		int32_t cols;
+		int32_t depth;
+		uint32_t shipsNum[PLAYERS_NUM];
+		uint64_t sourceSize;																/* size and hash of the .sboard file that was compiled */
+		uint64_t sourceHash;
+	};
+
+	struct ShipRecord
+	{
+		int32_t symbol;
+		int32_t cellsNum;
+	};
+
+	/* size of the cells part, with the padding */
+	static size_t cellsBytes(size_t cellsNum) { return (cellsNum + 3) & ~size_t(3); }
+};
+
+template<typename T>
+bool CompiledBoard::readValue(const char*& filePos, const char* fileEnd, T& value)
+{
+	if (static_cast<size_t>(fileEnd - filePos) < sizeof(T)) return false;
+
+	memcpy(&value, filePos, sizeof(T));														/* the file data is not aligned to T */
+	filePos += sizeof(T);
+	return true;
+}
+
+template<typename T>
+void CompiledBoard::appendValue(std::vector<char>& fileContent, const T& value)
+{
+	auto valuePos = fileContent.size();
+	fileContent.resize(valuePos + sizeof(T));
+	memcpy(&fileContent[valuePos], &value, sizeof(T));
+}
@@ -0,0 +1,107 @@
+#include "CoordinatesPool.h"
+#include <algorithm>
+
+void CoordinatesPool::init(int boardRows, int boardCols, int boardDepth)
+{
+	rows = boardRows + 2;
+	cols = boardCols + 2;
+	depth = boardDepth + 2;
+	words.assign((rows * cols * depth + WORD_BITS - 1) / WORD_BITS, 0);
+	wordsCountTree.assign(words.size() + 1, 0);
+	coordinatesNum = 0;
+}
+
+void CoordinatesPool::clear()
+{
+	std::fill(words.begin(), words.end(), 0);
+	std::fill(wordsCountTree.begin(), wordsCountTree.end(), 0);
+	coordinatesNum = 0;
+}
+
+void CoordinatesPool::insert(const Coordinate& coor)
+{
+	auto index = cellIndex(coor);
+	if (index < 0) return;
+
+	auto bit = uint64_t(1) << (index % WORD_BITS);
+	auto& word = words[index / WORD_BITS];
+	if (word & bit) return;
+
+	word |= bit;
+	updateWordCount(index / WORD_BITS, 1);
+	coordinatesNum++;
+}
+
+void CoordinatesPool::erase(const Coordinate& coor)
+{
+	auto index = cellIndex(coor);
+	if (index < 0) return;
+
+	auto bit = uint64_t(1) << (index % WORD_BITS);
+	auto& word = words[index / WORD_BITS];
+	if (!(word & bit)) return;
+
+	word &= ~bit;
+	updateWordCount(index / WORD_BITS, -1);
+	coordinatesNum--;
+}
+
+bool CoordinatesPool::contains(const Coordinate& coor) const
+{
+	auto index = cellIndex(coor);
+	return index >= 0 && (words[index / WORD_BITS] >> (index % WORD_BITS) & 1) != 0;
+}
+
+void CoordinatesPool::insertAll(const CoordinatesPool& other)
+{
+	for (size_t w = 0; w < words.size(); w++)
+	{
+		auto added = other.words[w] & ~words[w];
+		if (added == 0) continue;
+
+		auto addedNum = BattleshipGameUtils::popcount(added);
+		words[w] |= added;
+		updateWordCount(static_cast<int>(w), addedNum);
+		coordinatesNum += addedNum;
+	}
+}
+
+Coordinate CoordinatesPool::at(int k) const
+{
+	/* select on the Fenwick tree - the word that has the k-th coordinate, and k is left as its rank in the word */
+	auto word = 0;
+	auto treeSize = static_cast<int>(wordsCountTree.size()) - 1;
+	auto step = 1;
+	while (step * 2 <= treeSize) step *= 2;
+
+	for (; step > 0; step /= 2)
+	{
+		if (word + step <= treeSize && wordsCountTree[word + step] <= k)
+		{
+			word += step;
+			k -= wordsCountTree[word];
+		}
+	}
+
+	auto bits = words[word];
+	for (; k > 0; k--) bits &= bits - 1;															/* clear the k lower coordinates of the word */
+	return cellCoordinate(word * WORD_BITS + BattleshipGameUtils::popcount((bits & (~bits + 1)) - 1));
+}
+
+int CoordinatesPool::cellIndex(const Coordinate& coor) const
+{
+	/* the padded coordinate is 0 - dimension + 1 */
+	if (coor.row < 0 || coor.row >= rows || coor.col < 0 || coor.col >= cols || coor.depth < 0 || coor.depth >= depth) return -1;
+	return (coor.col * rows + coor.row) * depth + coor.depth;										/* the order of Coordinate's operator< */
+}
+
+Coordinate CoordinatesPool::cellCoordinate(int index) const
+{
+	return Coordinate((index / depth) % rows, index / (depth * rows), index % depth);
+}
+
+void CoordinatesPool::updateWordCount(int word, int delta)
+{
+	for (auto i = word + 1; i < static_cast<int>(wordsCountTree.size()); i += i & -i)
+		wordsCountTree[i] += delta;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "IBattleshipGameAlgo.h"
+#include "BattleshipGameUtils.h"
+
+/**
+ * \brief a set of (1-based) board coordinates for PlayerSmart - a dense bitset over the board cells with one cell of padding around the board
+ * (the player also keeps the neighbors of the border cells), and a Fenwick tree over the words popcounts for rank/select.
+ * insert, erase and contains are O(1), the k-th coordinate is O(log(words)), and the coordinates are kept in the order of Coordinate's operator<
+ * (col, row, depth) - so the k-th coordinate and the iteration order are the same as in a std::set<Coordinate>
+ */
+class CoordinatesPool
+{
+public:
+	CoordinatesPool() : rows(0), cols(0), depth(0), coordinatesNum(0) {}
+
+	/* sets the board dimensions and clears the pool */
+	void init(int boardRows, int boardCols, int boardDepth);
+
+	/* removes all the coordinates, the board dimensions are kept */
+	void clear();
+
+	/* coordinates out of the board and its padding are never in the pool (they are ignored by insert) */
+	void insert(const Coordinate& coor);
+	void erase(const Coordinate& coor);
+	bool contains(const Coordinate& coor) const;
+
+	/* inserts all the coordinates of the other pool, @assume both pools have the same dimensions */
+	void insertAll(const CoordinatesPool& other);
+
+	int size() const { return coordinatesNum; }
+	bool empty() const { return coordinatesNum == 0; }
+
+	/* the k-th coordinate in the pool order, @assume 0 <= k < size() */
+	Coordinate at(int k) const;
+
+	/* a uniform random coordinate of the pool, drawn as BattleshipGameUtils::randomIndex draws it. @assume the pool is not empty */
+	Coordinate randomCoordinate() const { return at(BattleshipGameUtils::randomIndex(coordinatesNum)); }
+
+	/* calls func(coor) for every coordinate in the pool order */
+	template<typename F>
+	void forEach(F func) const;
+
+private:
+	static const int WORD_BITS = 64;
+
+	int rows;																						/* the padded dimensions (board dimension + 2) */
+	int cols;
+	int depth;
+	int coordinatesNum;
+	std::vector<uint64_t> words;
+	std::vector<int> wordsCountTree;																/* Fenwick tree (1-based) of the number of coordinates in every word */
+
+	/* index of the coordinate in the bitset, or -1 if it is out of the padded board */
+	int cellIndex(const Coordinate& coor) const;
+	Coordinate cellCoordinate(int index) const;
+
+	/* adds delta to the count of the word */
+	void updateWordCount(int word, int delta);
+};
+
+template<typename F>
+void CoordinatesPool::forEach(F func) const
+{
+	for (size_t w = 0; w < words.size(); w++)
+	{
+		for (auto word = words[w]; word != 0; word &= word - 1)
+			func(cellCoordinate(static_cast<int>(w) * WORD_BITS + BattleshipGameUtils::popcount((word & (~word + 1)) - 1)));	/* the lowest set bit index */
+	}
+}
@@ -0,0 +1,86 @@
+#include "DensityMap.h"
+#include <algorithm>
+#include <iterator>
+
+void DensityMap::init(int boardRows, int boardCols, int boardDepth)
+{
+	rows = boardRows;
+	cols = boardCols;
+	depth = boardDepth;
+	std::fill(std::begin(shipsWeights), std::end(shipsWeights), 0);
+	freeCells.assign(rows * cols * depth, true);
+	densities.assign(rows * cols * depth, 0);
+}
+
+void DensityMap::setShipsCount(const std::vector<std::pair<int, int>>& shipsCount)
+{
+	std::fill(std::begin(shipsWeights), std::end(shipsWeights), 0);
+	for (auto& sizeCount : shipsCount)
+	{
+		if (sizeCount.first >= 1 && sizeCount.first <= MAX_SHIP_LEN)
+			shipsWeights[sizeCount.first] = std::max(sizeCount.second, 0);
+	}
+	rebuild();
+}
+
+void DensityMap::block(const Coordinate& coor)
+{
+	if (coor.row < 1 || coor.row > rows || coor.col < 1 || coor.col > cols || coor.depth < 1 || coor.depth > depth) return;
+
+	auto index = cellIndex(coor);
+	if (!freeCells[index]) return;
+
+	updateCellLines(index, coor, -1);
+	freeCells[index] = false;
+	updateCellLines(index, coor, 1);
+}
+
+void DensityMap::updateLine(int lineStart, int stride, int lineLen, bool withSizeOne, int sign)
+{
+	auto runStart = 0;
+	for (auto i = 0; i <= lineLen; i++)
+	{
+		if (i < lineLen && freeCells[lineStart + i * stride]) continue;
+
+		auto runLen = i - runStart;															/* the run of free cells [runStart, i) ended */
+		for (auto pos = 0; pos < runLen; pos++)
+			densities[lineStart + (runStart + pos) * stride] += sign * runCoverage(runLen, pos, withSizeOne);
+		runStart = i + 1;
+	}
+}
+
+int DensityMap::runCoverage(int runLen, int cellPos, bool withSizeOne) const
+{
+	auto coverage = 0;
+	for (auto shipLen = (withSizeOne ? 1 : 2); shipLen <= MAX_SHIP_LEN && shipLen <= runLen; shipLen++)
+	{
+		/* the ship can start at most shipLen cells before the cell, and it has to end in the run */
+		auto placements = std::min(std::min(cellPos + 1, runLen - cellPos), std::min(shipLen, runLen - shipLen + 1));
+		coverage += shipsWeights[shipLen] * placements;
+	}
+	return coverage;
+}
+
+void DensityMap::updateCellLines(int index, const Coordinate& coor, int sign)
+{
+	auto layerSize = rows * cols;
+	updateLine(index - (coor.col - 1), 1, cols, true, sign);
+	updateLine(index - (coor.row - 1) * cols, cols, rows, false, sign);
+	updateLine(index - (coor.depth - 1) * layerSize, layerSize, depth, false, sign);
+}
+
+void DensityMap::rebuild()
+{
+	auto layerSize = rows * cols;
+	std::fill(densities.begin(), densities.end(), 0);
+
+	for (auto d = 0; d < depth; d++)
+	{
+		for (auto r = 0; r < rows; r++)
+			updateLine(d * layerSize + r * cols, 1, cols, true, 1);
+		for (auto c = 0; c < cols; c++)
+			updateLine(d * layerSize + c, cols, rows, false, 1);
+	}
+	for (auto cell = 0; cell < layerSize; cell++)
+		updateLine(cell, layerSize, depth, false, 1);
+}
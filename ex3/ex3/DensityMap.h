@@ -0,0 +1,50 @@
+#pragma once
+#include <vector>
+#include "IBattleshipGameAlgo.h"
+
+/**
+ * \brief probability density of the opponent ships for PlayerSmart - for every cell, the number of placements of the remaining ships that cover it
+ * (every ship size is weighted by the number of ships of this size that are left). a placement is a line of free cells along one of the axes.
+ * when a cell is blocked only the three lines through it are updated, and when the remaining ships change the whole map is rebuilt.
+ * coordinates are 1-based (as in PlayerSmart)
+ */
+class DensityMap
+{
+public:
+	static const int MAX_SHIP_LEN = 4;
+
+	DensityMap() : rows(0), cols(0), depth(0), shipsWeights() {}
+
+	/* sets the board dimensions - all the cells are free and there are no ships (all the densities are 0) */
+	void init(int boardRows, int boardCols, int boardDepth);
+
+	/* sets the remaining ships - <shipSize, count> pairs, as PlayerSmart::shipsCount (negative counts are taken as 0), and rebuilds the map */
+	void setShipsCount(const std::vector<std::pair<int, int>>& shipsCount);
+
+	/* no ship can be placed on the cell (a miss, a sunk ship or a cell next to it). coordinates out of the board are ignored */
+	void block(const Coordinate& coor);
+
+	int density(const Coordinate& coor) const { return densities[cellIndex(coor)]; }		/* @assume the coordinate is in the board */
+
+private:
+	int rows;
+	int cols;
+	int depth;
+	int shipsWeights[MAX_SHIP_LEN + 1];															/* the number of remaining ships of every size (index 0 is not used) */
+	std::vector<char> freeCells;																/* not vector<bool> - a byte for every cell is faster to access */
+	std::vector<int> densities;
+
+	int cellIndex(const Coordinate& coor) const { return ((coor.depth - 1) * rows + (coor.row - 1)) * cols + (coor.col - 1); }
+
+	/* adds sign * (the placements along the line that cover the cell) to every cell of the line.
+	size one ships have no direction - they are counted only on the lines along the cols (withSizeOne) */
+	void updateLine(int lineStart, int stride, int lineLen, bool withSizeOne, int sign);
+
+	/* number of placements (of all the remaining ships) in a run of runLen free cells that cover the cell at cellPos of the run */
+	int runCoverage(int runLen, int cellPos, bool withSizeOne) const;
+
+	/* updates the three lines through the cell (see updateLine) */
+	void updateCellLines(int index, const Coordinate& coor, int sign);
+
+	void rebuild();
+};
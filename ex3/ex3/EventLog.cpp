@@ -0,0 +1,76 @@
+#include "EventLog.h"
+#include <cstdio>
+
+const std::string EventLog::EVENTS_FILENAME("tournament_events.jsonl");
+const size_t EventLog::FLUSH_THRESHOLD;
+
+EventLog::Event::Event(const EventLog& eventLog, const char* eventType)
+{
+	line = "{\"t_us\":" + std::to_string(eventLog.elapsedMicros());
+	add("event", eventType);
+}
+
+EventLog::Event& EventLog::Event::add(const char* key, const std::string& value)
+{
+	addKey(key);
+	line += '"';
+	for (auto ch : value)																	/* JSON string escaping */
+	{
+		if (ch == '"' || ch == '\\')
+		{
+			line += '\\';
+			line += ch;
+		}
+		else if (static_cast<unsigned char>(ch) < 0x20)
+		{
+			char escaped[8];
+			snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(ch));
+			line += escaped;
+		}
+		else line += ch;
+	}
+	line += '"';
+	return *this;
+}
+
+void EventLog::Event::addKey(const char* key)
+{
+	line += ",\"";
+	line += key;
+	line += "\":";
+}
+
+bool EventLog::open(const std::string& filePath)
+{
+	std::lock_guard<std::mutex> lock(bufferMutex);
+	outFile.open(filePath, std::ios::trunc | std::ios::out | std::ios::binary);
+	isLogOpen = outFile.is_open();
+	startTime = std::chrono::steady_clock::now();
+	buffer.reserve(FLUSH_THRESHOLD + FLUSH_THRESHOLD / 4);
+	return isLogOpen;
+}
+
+void EventLog::close()
+{
+	std::lock_guard<std::mutex> lock(bufferMutex);
+	if (!isLogOpen) return;
+
+	outFile.write(buffer.data(), buffer.size());
+	buffer.clear();
+	outFile.close();
+	isLogOpen = false;
+}
+
+void EventLog::write(const Event& event, bool canFlush)
+{
+	std::lock_guard<std::mutex> lock(bufferMutex);
+	if (!isLogOpen) return;
+
+	buffer += event.line;
+	buffer += "}\n";
+	if (canFlush && buffer.size() >= FLUSH_THRESHOLD)
+	{
+		outFile.write(buffer.data(), buffer.size());
+		buffer.clear();
+	}
+}
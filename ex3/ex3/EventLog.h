@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <fstream>
+#include <mutex>
+#include <chrono>
+#include <type_traits>
+
+/**
+ * \brief machine readable log of the tournament events (boards validation, games, threads) - one JSON object in every line,
+ * with the event type and the time since the log was opened. the lines are collected in a buffer and written in large chunks.
+ * write() can be called from any thread
+ */
+class EventLog
+{
+public:
+	static const std::string EVENTS_FILENAME;
+	static const size_t FLUSH_THRESHOLD = 64 * 1024;										/* the buffer is written to the file when it is larger than this (bytes) */
+
+	/* a single event line. built by the caller, then passed to write() */
+	class Event
+	{
+	public:
+		Event(const EventLog& eventLog, const char* eventType);
+
+		Event& add(const char* key, const std::string& value);
+		Event& add(const char* key, const char* value) { return add(key, std::string(value)); }
+		Event& add(const char* key, bool value) { addKey(key); line += (value ? "true" : "false"); return *this; }
+
+		template <typename T>
+		typename std::enable_if<std::is_integral<T>::value, Event&>::type add(const char* key, T value) { addKey(key); line += std::to_string(value); return *this; }
+
+	private:
+		friend class EventLog;
+		std::string line;
+
+		void addKey(const char* key);
+	};
+
+	EventLog() : isLogOpen(false) {}
+	~EventLog() { close(); }
+
+	EventLog(const EventLog& otherLog) = delete;											/* deletes copy constructor */
+	EventLog& operator=(const EventLog& otherLog) = delete;									/* deletes copy assignment */
+
+	/* opens (truncates) the events file. the events times are from now */
+	bool open(const std::string& filePath);
+	/* writes the buffered events and closes the file */
+	void close();
+	bool isOpen() const { return isLogOpen; }
+
+	/* canFlush = false only adds the event to the buffer (for a caller that holds another lock - the next write() flushes it) */
+	void write(const Event& event, bool canFlush = true);
+
+	/* microseconds since the log was opened */
+	long long elapsedMicros() const { return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count(); }
+
+private:
+	bool isLogOpen;
+	std::ofstream outFile;
+	std::mutex bufferMutex;
+	std::string buffer;																		/* events that were not written to the file yet */
+	std::chrono::steady_clock::time_point startTime;
+};
@@ -0,0 +1,64 @@
+#include "FreeRunsIndex.h"
+
+void FreeRunsIndex::init(int boardRows, int boardCols, int boardDepth)
+{
+	rows = boardRows;
+	cols = boardCols;
+	depth = boardDepth;
+
+	for (auto a = 0; a < AXES_NUM; a++)
+	{
+		auto axis = static_cast<Axis>(a);
+		auto len = axisLength(axis);
+		forwardRuns[a].resize(rows * cols * depth);
+		backwardRuns[a].resize(rows * cols * depth);
+
+		/* the whole line is one run */
+		for (auto d = 1; d <= depth; d++)
+		{
+			for (auto r = 1; r <= rows; r++)
+			{
+				for (auto c = 1; c <= cols; c++)
+				{
+					Coordinate coor(r, c, d);
+					auto pos = axisPosition(coor, axis);
+					forwardRuns[a][cellIndex(coor)] = len - pos;
+					backwardRuns[a][cellIndex(coor)] = pos + 1;
+				}
+			}
+		}
+	}
+}
+
+void FreeRunsIndex::block(const Coordinate& coor)
+{
+	if (!isInBoard(coor)) return;
+
+	auto index = cellIndex(coor);
+	if (forwardRuns[0][index] == 0) return;													/* already blocked */
+
+	for (auto a = 0; a < AXES_NUM; a++)
+	{
+		auto axis = static_cast<Axis>(a);
+		auto stride = axisStride(axis);
+		auto pos = axisPosition(coor, axis);
+		auto len = axisLength(axis);
+		auto& forward = forwardRuns[a];
+		auto& backward = backwardRuns[a];
+
+		/* the run before the cell ends now at the cell, and the run after it starts after it */
+		for (auto i = 1; i <= pos && forward[index - i * stride] != 0; i++)
+			forward[index - i * stride] = i;
+		for (auto i = 1; pos + i < len && backward[index + i * stride] != 0; i++)
+			backward[index + i * stride] = i;
+
+		forward[index] = 0;
+		backward[index] = 0;
+	}
+}
+
+int FreeRunsIndex::freeRun(const Coordinate& start, Axis axis, int direction) const
+{
+	if (!isInBoard(start)) return 0;
+	return (direction > 0 ? forwardRuns[axis][cellIndex(start)] : backwardRuns[axis][cellIndex(start)]);
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+#include "IBattleshipGameAlgo.h"
+
+/**
+ * \brief the free runs of the board lines for PlayerSmart - for every cell, axis and direction, the number of free cells in a row that start at the cell
+ * (0 if the cell is blocked). when a cell is blocked only the runs that it splits are updated (the cells of its three lines between it and the
+ * previous blocked cells), so the distance to the next wall is a lookup instead of a walk over the line.
+ * a block is O(line length), not the O(log) update of a sorted set of blocked cells for every line: the board lines are short (15 cells in a 15x15x15 board),
+ * and rewriting a few ints is cheaper than a tree node insert. in return freeRun is O(1), and it runs far more often (6 lookups in every walls check).
+ * coordinates are 1-based (as in PlayerSmart)
+ */
+class FreeRunsIndex
+{
+public:
+	enum Axis { ROWS_AXIS = 0, COLS_AXIS = 1, DEPTH_AXIS = 2 };
+	static const int AXES_NUM = 3;
+
+	FreeRunsIndex() : rows(0), cols(0), depth(0) {}
+
+	/* sets the board dimensions - all the cells are free */
+	void init(int boardRows, int boardCols, int boardDepth);
+
+	/* the cell is not free anymore - O(line length) on each axis. coordinates out of the board are ignored */
+	void block(const Coordinate& coor);
+
+	/* number of free cells in a row from start (including it) along the axis, in the direction (1 or -1). 0 if start is blocked or out of the board */
+	int freeRun(const Coordinate& start, Axis axis, int direction) const;
+
+private:
+	int rows;
+	int cols;
+	int depth;
+	std::vector<int> forwardRuns[AXES_NUM];													/* the runs in the direction of the growing coordinate */
+	std::vector<int> backwardRuns[AXES_NUM];
+
+	bool isInBoard(const Coordinate& coor) const { return coor.row >= 1 && coor.row <= rows && coor.col >= 1 && coor.col <= cols && coor.depth >= 1 && coor.depth <= depth; }
+	int cellIndex(const Coordinate& coor) const { return ((coor.depth - 1) * rows + (coor.row - 1)) * cols + (coor.col - 1); }
+
+	/* the index step, the line length and the 0-based position in the line of the cell along the axis */
+	int axisStride(Axis axis) const { return (axis == COLS_AXIS ? 1 : (axis == ROWS_AXIS ? cols : rows * cols)); }
+	int axisLength(Axis axis) const { return (axis == COLS_AXIS ? cols : (axis == ROWS_AXIS ? rows : depth)); }
+	static int axisPosition(const Coordinate& coor, Axis axis) { return (axis == COLS_AXIS ? coor.col : (axis == ROWS_AXIS ? coor.row : coor.depth)) - 1; }
+};
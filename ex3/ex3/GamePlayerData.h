@@ -19,12 +19,13 @@ private:
 	size_t currShipsCount;							/* current avaliable ship for the player*/
 	int score;										/* current score */
 	bool hasMoreMoves;
+	int movesCount;									/* number of attacks the player made in this game */
 
 	static const int UNDEFINED_PLAYERID = -1;
 
-	GamePlayerData() : id(UNDEFINED_PLAYERID), playerAlgo(nullptr), shipsBoard(), currShipsCount(0), score(0), hasMoreMoves(true) {}
+	GamePlayerData() : id(UNDEFINED_PLAYERID), playerAlgo(nullptr), shipsBoard(), currShipsCount(0), score(0), hasMoreMoves(true), movesCount(0) {}
 	
-	GamePlayerData(int playerID, IBattleshipGameAlgo* inputPlayerAlgo, ShipsBoard inputShipsBoard, size_t shipsCount) : id(playerID), playerAlgo(inputPlayerAlgo), shipsBoard(std::move(inputShipsBoard)), currShipsCount(shipsCount), score(0), hasMoreMoves(true) {}
+	GamePlayerData(int playerID, IBattleshipGameAlgo* inputPlayerAlgo, ShipsBoard inputShipsBoard, size_t shipsCount) : id(playerID), playerAlgo(inputPlayerAlgo), shipsBoard(std::move(inputShipsBoard)), currShipsCount(shipsCount), score(0), hasMoreMoves(true), movesCount(0) {}
 	
 	~GamePlayerData() = default;
 
@@ -32,10 +33,12 @@ private:
 	GamePlayerData(const GamePlayerData& otherPlayer) = delete;						/* deletes copy constructor */
 	
 	GamePlayerData(GamePlayerData&& other)noexcept = delete;						/* deletes move c'tor */
-	GamePlayerData& GamePlayerData::operator=(GamePlayerData&& other) noexcept;		/*  move assignment */
+	GamePlayerData& operator=(GamePlayerData&& other) noexcept;		/*  move assignment */
 	
 	
-	/*get next valid attack coordinates,if player doesnt have more moves return <-1,-1,-1>*/
+	/*get next valid attack coordinates,if player doesnt have more moves return <-1,-1,-1>
+	 Algo is the concrete type of playerAlgo when it is known at compile time (built-in algos), so the attack() calls are not virtual */
+	template <typename Algo = IBattleshipGameAlgo>
 	Coordinate getAlgoNextAttack() const;
 
 	/* given coordinates player updates number of ships he has got left&& updates the attack in his ships details.
@@ -51,4 +54,27 @@ private:
 
 	//bool isSet()const { return id != UNDEFINED_PLAYERID && playerAlgo && shipsBoard.isSet() && currShipsCount > 0; }
 
-};
\ No newline at end of file
+};
+
+
+template <typename Algo>
+Coordinate GamePlayerData::getAlgoNextAttack() const
+{
+	auto algo = static_cast<Algo*>(playerAlgo);
+	Coordinate tmpAttack = algo->attack();
+
+	if (tmpAttack.row == -1 && tmpAttack.col == -1 && tmpAttack.depth == -1) { // player doesnt have anymore moves 
+		return tmpAttack;
+	}
+
+	// while the given coordinates are not in the board && the player has more moves
+	while (!shipsBoard.isCoordianteInShipBoard(tmpAttack.row - 1, tmpAttack.col - 1,tmpAttack.depth-1 ))
+	{
+		tmpAttack = algo->attack();
+		if (tmpAttack.row == -1 && tmpAttack.col == -1 && tmpAttack.depth == -1) { // player doesnt have anymore moves
+			return tmpAttack;
+		}
+
+	}
+	return tmpAttack;
+}
@@ -50,7 +50,18 @@ public:
 	virtual void notifyOnAttackResult(int player, Coordinate move, AttackResult result) = 0; // last move result
 };
 
-#ifdef ALGO_EXPORTS										// A flag defined in this project's Preprocessor's Definitions
+/* helper threads that the Game Manager shares between all the algos of the tournament (see SetAlgorithmHelperPool) */
+class IAlgoHelperPool
+{
+public:
+	virtual ~IAlgoHelperPool() = default;
+	virtual int helpersNum() const = 0;					// the threads of the pool, besides the calling thread
+	virtual void run(void(*task)(void* context, int taskIndex), void* context, int tasksNum) = 0;	// runs task(context, i) for every i in [0, tasksNum) on the calling thread and the free helpers, returns when all are done
+};
+
+#ifndef _WIN32
+#define ALGO_API extern "C" __attribute__((visibility("default")))		// linux shared objects (.so) - no import/export declarations
+#elif defined(ALGO_EXPORTS)								// A flag defined in this project's Preprocessor's Definitions
 #define ALGO_API extern "C" __declspec(dllexport)		// If we build - export
 #else
 #define ALGO_API extern "C" __declspec(dllimport)		// If someone else includes this .h - import
@@ -62,4 +73,22 @@ public:
 * The reason that we don't return a unique_ptr instead, is that it is bad practice to export cpp methods due to their name mangling.
 * When working with shared objects (dlls), the interface must be a C interface.
 */
-ALGO_API IBattleshipGameAlgo* GetAlgorithm(); // This method must be implemented in each player(algorithm) .cpp file
\ No newline at end of file
+ALGO_API IBattleshipGameAlgo* GetAlgorithm(); // This method must be implemented in each player(algorithm) .cpp file
+
+/* Optional v2 entry points (ABI version 2):
+* A dll that exports GetAlgorithmV2 must also export DestroyAlgorithm. In this case the Game Manager creates the instances with GetAlgorithmV2,
+* and returns every instance to the dll with DestroyAlgorithm instead of deleting it, so the dll is the one that frees (or recycles) its own memory.
+* ResetAlgorithm is optional - it is called before an instance is reused in a new game (before setPlayer and setBoard), to clear its state cheaply.
+* SetAlgorithmTimeBudget is optional - if the tournament has a time budget, it is called before every game (after ResetAlgorithm) with the time the algo
+* should take in every call (attack or notifyOnAttackResult) and in the whole game, in microseconds (0 is no budget). an anytime algo can stop its
+* expensive work early to keep in the budget.
+* SetAlgorithmHelperPool is optional - if the tournament has helper threads, it is called before every game (after ResetAlgorithm) with a pool
+* that is shared by all the algos and lives until the instance is destroyed. the algo creates no threads of its own - it runs its parallel work with
+* IAlgoHelperPool::run inside its calls.
+*/
+const int ALGO_ABI_VERSION = 2;
+ALGO_API IBattleshipGameAlgo* GetAlgorithmV2(int abiVersion);	// returns nullptr if the dll does not support the requested abiVersion
+ALGO_API void DestroyAlgorithm(IBattleshipGameAlgo* algo);			// algo must be an instance that was returned by GetAlgorithmV2 of the same dll
+ALGO_API void ResetAlgorithm(IBattleshipGameAlgo* algo);			// optional
+ALGO_API void SetAlgorithmTimeBudget(IBattleshipGameAlgo* algo, int moveBudgetMicros, int gameBudgetMicros);	// optional
+ALGO_API void SetAlgorithmHelperPool(IBattleshipGameAlgo* algo, IAlgoHelperPool* helperPool);					// optional
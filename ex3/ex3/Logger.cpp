@@ -1,25 +1,115 @@
 #include "Logger.h"
 #include <chrono>
 #include <iostream>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdio>
 
 LogLevel Logger::logLevel = DEFAULT_LEVEL;
 std::ofstream Logger::outFile;
+std::mutex Logger::syncMutex;
+std::atomic<bool> Logger::isAsync(false);
+std::unique_ptr<Logger::AsyncQueue> Logger::asyncQueue;
+std::thread Logger::writerThread;
 const std::string DEFAULT_FILENAME = "game.log";
 
+/* bounded multi producers single consumer ring (every slot has a sequence number that tells if it is free for the producer of this position,
+ * or ready for the consumer). the producers only CAS the enqueue position, and the slots strings keep their capacity between the entries */
+struct Logger::AsyncQueue
+{
+	struct Slot
+	{
+		std::atomic<size_t> sequence;
+		LogMessage msg;
+		LogLevel level;
+		time_t entryTime;
+	};
+
+	std::unique_ptr<Slot[]> slots;
+	size_t capacity;																	/* a power of 2 */
+	std::atomic<size_t> enqueuePos;
+	size_t dequeuePos;																	/* only the writer thread touches it */
+	std::atomic<bool> isClosing;
+	std::mutex writerMutex;																/* only for the writer idle wait */
+	std::condition_variable writerCondition;
+
+	explicit AsyncQueue(size_t queueCapacity) : slots(new Slot[queueCapacity]), capacity(queueCapacity), enqueuePos(0), dequeuePos(0), isClosing(false)
+	{
+		for (size_t i = 0; i < capacity; i++)
+			slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	/* returns false if the queue is full. Message is std::string or LogMessage */
+	template <typename Message>
+	bool tryPush(const Message& msg, LogLevel level, time_t entryTime)
+	{
+		auto pos = enqueuePos.load(std::memory_order_relaxed);
+		Slot* slot;
+		for (;;)
+		{
+			slot = &slots[pos & (capacity - 1)];
+			auto seqDiff = static_cast<std::ptrdiff_t>(slot->sequence.load(std::memory_order_acquire) - pos);
+			if (seqDiff == 0)
+			{
+				if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+			}
+			else if (seqDiff < 0) return false;											/* the slot was not consumed yet since the last round */
+			else pos = enqueuePos.load(std::memory_order_relaxed);						/* another producer took this position */
+		}
+
+		assignMessage(slot->msg, msg);
+		slot->level = level;
+		slot->entryTime = entryTime;
+		slot->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	static void assignMessage(LogMessage& slotMsg, const std::string& msg) { slotMsg.assign(msg); }
+	static void assignMessage(LogMessage& slotMsg, const LogMessage& msg) { slotMsg = msg; }
+
+	/* returns the next ready slot (or nullptr), the slot must be released with pop() */
+	Slot* front()
+	{
+		auto slot = &slots[dequeuePos & (capacity - 1)];
+		return (slot->sequence.load(std::memory_order_acquire) == dequeuePos + 1 ? slot : nullptr);
+	}
+
+	void pop()
+	{
+		slots[dequeuePos & (capacity - 1)].sequence.store(dequeuePos + capacity, std::memory_order_release);
+		dequeuePos++;
+	}
+};
 
 
 /* trunc -  any current content is discarded, assuming a length of zero on opening.*/
 /* ios::out allows output (write operations) to a stream.*/
-void Logger::Init(const std::string & loggerFilePath, LogLevel inputLevel)
+void Logger::Init(const std::string & loggerFilePath, LogLevel inputLevel, bool asyncMode)
 {
 	logLevel = inputLevel;
 	outFile =  std::ofstream(loggerFilePath, std::ios::trunc | std::ios::out);
 	printLogEntry("########### Progaram successfully Started ########### \n", "----");
-	printLogEntry(" Log Level is : " + levelEnumToString(logLevel), "----");
+	printLogEntry(" Log Level is : " + std::string(levelEnumToString(logLevel)), "----");
+
+	if (asyncMode && outFile.is_open())
+	{
+		asyncQueue.reset(new AsyncQueue(ASYNC_QUEUE_CAPACITY));
+		writerThread = std::thread(&Logger::writerJob);
+		isAsync = true;
+	}
 }
 
 void Logger::Close()
 {
+	if (isAsync)																		/* all the other threads are done - the writer writes what is left in the queue */
+	{
+		asyncQueue->isClosing = true;
+		asyncQueue->writerCondition.notify_one();
+		writerThread.join();
+		isAsync = false;
+		asyncQueue.reset();
+	}
+
 	outFile << std::endl;
 	printLogEntry("########### Tournament finished. Log closed. ########### \n", "----");
 	outFile.close();
@@ -27,22 +117,64 @@ void Logger::Close()
 
 void Logger::append(const std::string & msg, LogLevel level)
 {
-	if (level > logLevel) return;
+	if (!isEnabled(level)) return;
+
+	if (isAsync.load(std::memory_order_relaxed))
+	{
+		auto entryTime = time(nullptr);
+		while (!asyncQueue->tryPush(msg, level, entryTime))								/* bounded memory - wait for the writer instead of dropping the entry */
+			std::this_thread::yield();
+		return;
+	}
 	printLogEntry(msg, levelEnumToString(level));
 }
 
-/* format is YYYY-MM-DD HH:mm:ss */
-std::string Logger::getTimeInfo() 
+void Logger::append(const LogMessage& message, LogLevel level)
 {
-		time_t     now = time(nullptr);
+	if (isAsync.load(std::memory_order_relaxed))
+	{
+		auto entryTime = time(nullptr);
+		while (!asyncQueue->tryPush(message, level, entryTime))
+			std::this_thread::yield();
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(syncMutex);
+	if (outFile.is_open())
+	{
+		writeLogEntry(message, levelEnumToString(level), time(nullptr));
+		outFile.flush();
+	}
+}
+
+void Logger::append(const LogEntries& entries)
+{
+	for (auto& entry : entries)
+		append(entry.first, entry.second);
+}
+
+/* format is YYYY-MM-DD HH:mm:ss. the last formatted time is kept - the entries of the same second are not formatted again.
+ * called only under syncMutex or from the writer thread */
+const std::string& Logger::getTimeInfo(time_t entryTime)
+{
+		static time_t lastTime = 0;
+		static std::string lastTimeInfo;
+		if (entryTime == lastTime && !lastTimeInfo.empty()) return lastTimeInfo;
+
 		struct tm  tstruct;
 		char       buf[TIME_BUF_SIZE];
-		localtime_s(&tstruct, &now);
+#ifdef _WIN32
+		localtime_s(&tstruct, &entryTime);
+#else
+		localtime_r(&entryTime, &tstruct);
+#endif
 		strftime(buf, sizeof(buf), "%Y-%m-%d %X", &tstruct);
-		return buf;
+		lastTime = entryTime;
+		lastTimeInfo = buf;
+		return lastTimeInfo;
 }
 
-std::string Logger::levelEnumToString(LogLevel l)
+const char* Logger::levelEnumToString(LogLevel l)
 {
 	if (l == LogLevel::Error) return "ERROR";
 	else if (l == LogLevel::Warning) return "WARNING";
@@ -52,8 +184,57 @@ std::string Logger::levelEnumToString(LogLevel l)
 
 void Logger::printLogEntry(const std::string & msg, const std::string& level)
 {
+	std::lock_guard<std::mutex> lock(syncMutex);
 	if (outFile.is_open())
 	{
-		outFile << getTimeInfo() << " \t[" << level << "] " << msg << std::endl;
+		outFile << getTimeInfo(time(nullptr)) << " \t[" << level << "] " << msg << std::endl;
+	}
+}
+
+void Logger::writeLogEntry(const LogMessage& message, const char* level, time_t entryTime)
+{
+	outFile << getTimeInfo(entryTime) << " \t[" << level << "] ";
+	message.writeTo(outFile);
+	outFile << '\n';
+}
+
+void LogMessage::writeTo(std::ostream& out) const
+{
+	size_t textPos = 0;
+	char numberBuf[32];
+	for (const auto& number : numbers)
+	{
+		out.write(text.data() + textPos, number.textPos - textPos);
+		textPos = number.textPos;
+
+		if (number.isSigned) snprintf(numberBuf, sizeof(numberBuf), "%lld", static_cast<long long>(number.value));
+		else snprintf(numberBuf, sizeof(numberBuf), "%llu", number.value);
+		out << numberBuf;
+	}
+	out.write(text.data() + textPos, text.size() - textPos);
+}
+
+void Logger::writerJob()
+{
+	auto& queue = *asyncQueue;
+	for (;;)
+	{
+		auto hasEntries = false;
+		while (auto slot = queue.front())												/* a batch - all the entries that are ready, with a single flush */
+		{
+			writeLogEntry(slot->msg, levelEnumToString(slot->level), slot->entryTime);
+			queue.pop();
+			hasEntries = true;
+		}
+
+		if (hasEntries)
+		{
+			outFile.flush();
+			continue;
+		}
+		if (queue.isClosing) return;													/* closing and the queue is empty */
+
+		std::unique_lock<std::mutex> lock(queue.writerMutex);
+		queue.writerCondition.wait_for(lock, std::chrono::milliseconds(int(WRITER_IDLE_WAIT_MS)));
 	}
 }
@@ -1,33 +1,139 @@
 #pragma once
 #include <fstream>
 #include <string>
+#include <vector>
+#include <utility>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <ctime>
+#include <ostream>
+#include <type_traits>
+
+/* the highest level that is compiled in (the LogLevel value) - Debug statements are removed from release builds */
+#ifndef LOGGER_COMPILED_LEVEL
+#ifdef NDEBUG
+#define LOGGER_COMPILED_LEVEL 2
+#else
+#define LOGGER_COMPILED_LEVEL 3
+#endif
+#endif
+
+/* LOG_DEBUG(args...) - Logger::log(Debug, args...), and nothing at all (the args are not even evaluated) when Debug is not compiled in */
+#if LOGGER_COMPILED_LEVEL >= 3
+#define LOG_DEBUG(...) Logger::log(Debug, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
 
 enum LogLevel
 {
 	Error, Warning, Info, Debug,
 };
 
+typedef std::vector<std::pair<std::string, LogLevel>> LogEntries;			/* log messages that were collected in a worker thread, to be written later by order */
+
+/**
+ * \brief a log message with deferred formatting - the text parts are copied as they are, and the numbers are kept as values
+ * and converted to text only when the message is written (in async mode - by the writer thread)
+ */
+class LogMessage
+{
+public:
+	void clear() { text.clear(); numbers.clear(); }
+	void assign(const std::string& msg) { text.assign(msg); numbers.clear(); }
+
+	void add(const std::string& str) { text += str; }
+	void add(const char* str) { text += str; }
+	void add(char ch) { text += ch; }
+
+	template <typename T>
+	typename std::enable_if<std::is_integral<T>::value>::type add(T value) { numbers.push_back({ text.size(), std::is_signed<T>::value, static_cast<unsigned long long>(value) }); }
+
+	/* writes the message - the text with every number in its place */
+	void writeTo(std::ostream& out) const;
+
+private:
+	struct Number
+	{
+		size_t textPos;																	/* the number is written before text[textPos] */
+		bool isSigned;
+		unsigned long long value;
+	};
+
+	std::string text;
+	std::vector<Number> numbers;
+};
+
+/**
+ * \brief the program log. append() can be called from any thread:
+ * in sync mode every entry is written (and flushed) under a mutex, in async mode the entries are pushed to a bounded lock-free queue,
+ * and a single writer thread writes them to the file in batches. Close() writes all the entries that are left in the queue
+ */
 class Logger
 {
 
 public: 
 	
-	static void Init(const std::string& loggerFilePath = DEFAULT_FILENAME, LogLevel inputLevel = LogLevel::Info);
+	static void Init(const std::string& loggerFilePath = DEFAULT_FILENAME, LogLevel inputLevel = LogLevel::Info, bool asyncMode = false);
 	static void Close();
 	static void append(const std::string& msg, LogLevel level);
+	static void append(const LogEntries& entries);
+
+	/* true if messages of this level are written - check it before building a message that is expensive to format */
+	static bool isEnabled(LogLevel level) { return level <= COMPILED_LEVEL && level <= logLevel; }
+
+	/* logs the concatenation of args (strings, chars and integers). nothing is formatted if the level is not enabled,
+	 * and the integers are converted to text only when the message is written */
+	template <typename... Args>
+	static void log(LogLevel level, const Args&... args)
+	{
+		if (!isEnabled(level)) return;
+
+		thread_local LogMessage message;											/* keeps its capacity between the messages of this thread */
+		message.clear();
+		addArgs(message, args...);
+		append(message, level);
+	}
 	
 	static const LogLevel DEFAULT_LEVEL = Info; 
+	static const LogLevel COMPILED_LEVEL = static_cast<LogLevel>(LOGGER_COMPILED_LEVEL);
 	static const std::string DEFAULT_FILENAME;
+	static const size_t ASYNC_QUEUE_CAPACITY = 4096;									/* entries - a full queue blocks the threads that append until the writer makes room */
 	
 private:
 	static const int TIME_BUF_SIZE = 80;
+	static const int WRITER_IDLE_WAIT_MS = 5;											/* how long the writer sleeps when the queue is empty */
 	
 	Logger() = delete;
 
+	struct AsyncQueue;																	/* the entries ring of the async mode (see Logger.cpp) */
+
 	static LogLevel logLevel;
 	static std::ofstream outFile;
+	static std::mutex syncMutex;														/* sync mode - one entry is written at a time */
+	static std::atomic<bool> isAsync;
+	static std::unique_ptr<AsyncQueue> asyncQueue;
+	static std::thread writerThread;
 
-	static std::string getTimeInfo();
-	static std::string levelEnumToString(LogLevel l);
+	static const std::string& getTimeInfo(time_t entryTime);
+	static const char* levelEnumToString(LogLevel l);
 	static void printLogEntry(const std::string & msg, const std::string& level);
-};
\ No newline at end of file
+	static void append(const LogMessage& message, LogLevel level);
+
+	/* writes the given entry to the file buffer - without a flush */
+	static void writeLogEntry(const LogMessage& message, const char* level, time_t entryTime);
+
+	static void addArgs(LogMessage&) {}
+
+	template <typename T, typename... Args>
+	static void addArgs(LogMessage& message, const T& arg, const Args&... args)
+	{
+		message.add(arg);
+		addArgs(message, args...);
+	}
+
+	/* the async writer thread - writes the queue entries until Close() is called and the queue is empty */
+	static void writerJob();
+};
@@ -0,0 +1,78 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+
+#include <windows.h>
+
+MappedFile::MappedFile(const std::string& filePath) : isFileOpen(false), fileData(nullptr), fileSize(0), fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr)
+{
+	fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (fileHandle == INVALID_HANDLE_VALUE) return;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(fileHandle, &size)) return;
+
+	isFileOpen = true;
+	fileSize = static_cast<size_t>(size.QuadPart);
+	if (fileSize == 0) return;																/* can not map an empty file - there is nothing to read anyway */
+
+	mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mappingHandle)
+		fileData = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+
+	if (!fileData)
+	{
+		isFileOpen = false;
+		fileSize = 0;
+	}
+}
+
+MappedFile::~MappedFile()
+{
+	if (fileData) UnmapViewOfFile(fileData);
+	if (mappingHandle) CloseHandle(mappingHandle);
+	if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+}
+
+#else
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string& filePath) : isFileOpen(false), fileData(nullptr), fileSize(0), fileHandle(nullptr), mappingHandle(nullptr)
+{
+	int fd = open(filePath.c_str(), O_RDONLY);
+	if (fd < 0) return;
+
+	struct stat fileStat;
+	if (fstat(fd, &fileStat) == 0 && S_ISREG(fileStat.st_mode))
+	{
+		isFileOpen = true;
+		fileSize = static_cast<size_t>(fileStat.st_size);
+
+		if (fileSize > 0)																	/* can not map an empty file - there is nothing to read anyway */
+		{
+			auto mapped = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (mapped != MAP_FAILED)
+			{
+				madvise(mapped, fileSize, MADV_SEQUENTIAL);
+				fileData = static_cast<const char*>(mapped);
+			}
+			else
+			{
+				isFileOpen = false;
+				fileSize = 0;
+			}
+		}
+	}
+	close(fd);																				/* the mapping stays valid after the file is closed */
+}
+
+MappedFile::~MappedFile()
+{
+	if (fileData) munmap(const_cast<char*>(fileData), fileSize);
+}
+
+#endif
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+/**
+ * \brief read only memory mapping of a whole file (mmap on linux, MapViewOfFile on windows).
+ * the file content is available with data() and size() until the object is destroyed
+ */
+class MappedFile
+{
+public:
+	explicit MappedFile(const std::string& filePath);
+	~MappedFile();
+
+	MappedFile(const MappedFile& otherFile) = delete;										/* deletes copy constructor */
+	MappedFile& operator=(const MappedFile& otherFile) = delete;							/* deletes copy assignment */
+
+	bool isOpen() const { return isFileOpen; }
+	const char* data() const { return fileData; }											/* nullptr for an empty file */
+	size_t size() const { return fileSize; }
+
+private:
+	bool isFileOpen;
+	const char* fileData;
+	size_t fileSize;
+	void* fileHandle;																		/* windows only - the file and its mapping handles */
+	void* mappingHandle;
+};
@@ -0,0 +1,48 @@
+#include "MonotonicArena.h"
+#include <algorithm>
+#include <cstdint>
+
+const size_t MonotonicArena::DEFAULT_BLOCK_SIZE;
+
+MonotonicArena::MonotonicArena(size_t initialBlockSize) : currBlock(0), currOffset(0)
+{
+	blocks.push_back({ std::unique_ptr<char[]>(new char[initialBlockSize]), initialBlockSize });
+}
+
+void* MonotonicArena::allocate(size_t size, size_t alignment)
+{
+	auto offset = alignedOffset(alignment);
+	if (offset + size > blocks[currBlock].size)
+	{
+		nextBlock(size, alignment);
+		offset = alignedOffset(alignment);
+	}
+
+	currOffset = offset + size;
+	return blocks[currBlock].memory.get() + offset;
+}
+
+size_t MonotonicArena::alignedOffset(size_t alignment) const
+{
+	auto blockBegin = reinterpret_cast<uintptr_t>(blocks[currBlock].memory.get());
+	return ((blockBegin + currOffset + alignment - 1) & ~(uintptr_t(alignment) - 1)) - blockBegin;
+}
+
+void MonotonicArena::reset()
+{
+	currBlock = 0;
+	currOffset = 0;
+}
+
+void MonotonicArena::nextBlock(size_t size, size_t alignment)
+{
+	currOffset = 0;
+	while (++currBlock < blocks.size())
+	{
+		if (size + alignment <= blocks[currBlock].size) return;									/* a block that was added in an earlier game */
+	}
+
+	auto blockSize = std::max(blocks.back().size * 2, size + alignment);					/* room for the allocation in any alignment of the block */
+	blocks.push_back({ std::unique_ptr<char[]>(new char[blockSize]), blockSize });
+	currBlock = blocks.size() - 1;
+}
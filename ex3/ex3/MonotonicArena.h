@@ -0,0 +1,85 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <new>
+
+/**
+ * \brief a monotonic memory arena for the state of a single game - allocations only bump a pointer in the current block,
+ * nothing is freed until reset(), which makes all the memory available again (the blocks themselves are kept).
+ * owned by a single games thread, so after the first games every game setup is done without the global heap
+ */
+class MonotonicArena
+{
+public:
+	static const size_t DEFAULT_BLOCK_SIZE = 4096;
+
+	explicit MonotonicArena(size_t initialBlockSize = DEFAULT_BLOCK_SIZE);
+	~MonotonicArena() = default;
+
+	MonotonicArena(const MonotonicArena& otherArena) = delete;								/* deletes copy constructor */
+	MonotonicArena& operator=(const MonotonicArena& otherArena) = delete;					/* deletes copy assignment */
+
+	/* returns size bytes aligned to alignment (a power of 2), valid until the next reset() */
+	void* allocate(size_t size, size_t alignment);
+
+	/* all the allocations are released at once (the objects in them must be destroyed already) */
+	void reset();
+
+private:
+	struct Block
+	{
+		std::unique_ptr<char[]> memory;
+		size_t size;
+	};
+
+	std::vector<Block> blocks;
+	size_t currBlock;																		/* the block we allocate from */
+	size_t currOffset;																		/* the first free byte in the current block */
+
+	/* the offset in the current block of the first free byte with the given alignment */
+	size_t alignedOffset(size_t alignment) const;
+
+	/* moves to the next block that has size bytes with the alignment, adds a new block if there is no such block */
+	void nextBlock(size_t size, size_t alignment);
+};
+
+/* std allocator over a MonotonicArena (deallocate does nothing - the memory returns on reset).
+ * without an arena it uses the global heap, so the containers that use it can also live out of a game */
+
+template <typename T>
+class ArenaAllocator
+{
+public:
+	typedef T value_type;
+	typedef std::true_type propagate_on_container_move_assignment;
+	typedef std::true_type propagate_on_container_swap;
+
+	ArenaAllocator() noexcept : arena(nullptr) {}
+	explicit ArenaAllocator(MonotonicArena* gameArena) noexcept : arena(gameArena) {}
+	template <typename U>
+	ArenaAllocator(const ArenaAllocator<U>& otherAllocator) noexcept : arena(otherAllocator.getArena()) {}
+
+	T* allocate(size_t n)
+	{
+		if (arena) return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+		return static_cast<T*>(::operator new(n * sizeof(T)));
+	}
+
+	void deallocate(T* p, size_t) noexcept
+	{
+		if (!arena) ::operator delete(p);
+	}
+
+	MonotonicArena* getArena() const noexcept { return arena; }
+
+private:
+	MonotonicArena* arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) noexcept { return a.getArena() == b.getArena(); }
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) noexcept { return !(a == b); }
@@ -0,0 +1,143 @@
+#include "PlacementSampler.h"
+#include "BattleshipGameUtils.h"
+#include <algorithm>
+#include <functional>
+
+void PlacementSampler::init(int boardRows, int boardCols, int boardDepth)
+{
+	rows = boardRows;
+	cols = boardCols;
+	depth = boardDepth;
+	shipsLens.clear();
+	freeCells.assign(rows * cols * depth, true);
+	hitsCounts.assign(rows * cols * depth, 0);
+	samplesNum = 0;
+}
+
+void PlacementSampler::setShipsCount(const std::vector<std::pair<int, int>>& shipsCount)
+{
+	shipsLens.clear();
+	for (auto& sizeCount : shipsCount)
+	{
+		if (sizeCount.first < 1 || sizeCount.first > MAX_SHIP_LEN) continue;
+		for (auto i = 0; i < sizeCount.second; i++) shipsLens.push_back(sizeCount.first);
+	}
+	std::sort(shipsLens.begin(), shipsLens.end(), std::greater<int>());
+}
+
+void PlacementSampler::block(const Coordinate& coor)
+{
+	if (coor.row < 1 || coor.row > rows || coor.col < 1 || coor.col > cols || coor.depth < 1 || coor.depth > depth) return;
+	freeCells[cellIndex(coor)] = false;
+}
+
+void PlacementSampler::setHelperPool(IAlgoHelperPool* pool)
+{
+	helperPool = pool;
+	workers.resize(helperPool ? helperPool->helpersNum() + 1 : 1);
+}
+
+void PlacementSampler::sampleTask(void* round, int workerIndex)
+{
+	auto& samplingRound = *static_cast<SamplingRound*>(round);
+	samplingRound.sampler->sampleUntil(samplingRound.sampler->workers[workerIndex], samplingRound.deadlineMicros, samplingRound.maxSamples);
+}
+
+int PlacementSampler::sample(int budgetMicros)
+{
+	auto cellsNum = freeCells.size();
+	for (auto& worker : workers)
+		if (worker.takenStamps.size() != cellsNum) worker.takenStamps.assign(cellsNum, 0);
+
+	auto workersNum = static_cast<int>(workers.size());
+	SamplingRound round = { this, BattleshipGameUtils::steadyClockMicros() + budgetMicros, (MAX_SAMPLES + workersNum - 1) / workersNum };
+	if (helperPool) helperPool->run(&PlacementSampler::sampleTask, &round, workersNum);		/* a task that starts after the deadline draws nothing */
+	else sampleTask(&round, 0);
+
+	std::fill(hitsCounts.begin(), hitsCounts.end(), 0);
+	samplesNum = 0;
+	for (auto& worker : workers)
+	{
+		for (size_t cell = 0; cell < cellsNum; cell++) hitsCounts[cell] += worker.hitsCounts[cell];
+		samplesNum += worker.samplesNum;
+	}
+	return samplesNum;
+}
+
+void PlacementSampler::sampleUntil(Worker& worker, long long deadlineMicros, int maxSamples) const
+{
+	static const int SAMPLES_BETWEEN_CLOCK_CHECKS = 16;
+
+	worker.hitsCounts.assign(freeCells.size(), 0);
+	worker.samplesNum = 0;
+	for (auto tries = 0; worker.samplesNum < maxSamples; tries++)
+	{
+		if (tries % SAMPLES_BETWEEN_CLOCK_CHECKS == 0 && BattleshipGameUtils::steadyClockMicros() >= deadlineMicros) return;
+		if (drawSample(worker)) worker.samplesNum++;
+		else if (tries >= maxSamples * 4) return;												/* the ships hardly fit - do not spin until the deadline */
+	}
+}
+
+bool PlacementSampler::drawSample(Worker& worker) const
+{
+	auto& engine = BattleshipGameUtils::threadRandomEngine();
+	std::uniform_int_distribution<int> cellDist(0, static_cast<int>(freeCells.size()) - 1);
+	std::uniform_int_distribution<int> axisDist(0, 2);
+	const int layerSize = rows * cols;
+	const int strides[3] = { 1, cols, layerSize };
+
+	if (++worker.stamp == 0)																	/* the stamps wrapped around - the old stamps may look like the new one */
+	{
+		std::fill(worker.takenStamps.begin(), worker.takenStamps.end(), 0);
+		worker.stamp = 1;
+	}
+	worker.shipsCells.clear();
+
+	for (auto shipLen : shipsLens)
+	{
+		auto placed = false;
+		for (auto t = 0; t < PLACEMENT_TRIES && !placed; t++)
+		{
+			/* a random first cell and direction - the ship has to end in the same line */
+			auto first = cellDist(engine);
+			auto axis = (shipLen == 1 ? 0 : axisDist(engine));
+			auto posInLine = (axis == 0 ? first % cols : (axis == 1 ? (first / cols) % rows : first / layerSize));
+			auto lineLen = (axis == 0 ? cols : (axis == 1 ? rows : depth));
+			if (posInLine + shipLen > lineLen) continue;
+
+			placed = true;
+			for (auto i = 0; i < shipLen && placed; i++)
+			{
+				auto cell = first + i * strides[axis];
+				placed = freeCells[cell] && worker.takenStamps[cell] != worker.stamp;
+			}
+			if (!placed) continue;
+
+			for (auto i = 0; i < shipLen; i++)
+			{
+				worker.shipsCells.push_back(first + i * strides[axis]);
+				takeCellAndNeighbors(worker, first + i * strides[axis]);
+			}
+		}
+		if (!placed) return false;
+	}
+
+	for (auto cell : worker.shipsCells) worker.hitsCounts[cell]++;
+	return true;
+}
+
+void PlacementSampler::takeCellAndNeighbors(Worker& worker, int index) const
+{
+	const int layerSize = rows * cols;
+	auto col = index % cols;
+	auto row = (index / cols) % rows;
+	auto d = index / layerSize;
+
+	worker.takenStamps[index] = worker.stamp;
+	if (col > 0) worker.takenStamps[index - 1] = worker.stamp;
+	if (col < cols - 1) worker.takenStamps[index + 1] = worker.stamp;
+	if (row > 0) worker.takenStamps[index - cols] = worker.stamp;
+	if (row < rows - 1) worker.takenStamps[index + cols] = worker.stamp;
+	if (d > 0) worker.takenStamps[index - layerSize] = worker.stamp;
+	if (d < depth - 1) worker.takenStamps[index + layerSize] = worker.stamp;
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <vector>
+#include "IBattleshipGameAlgo.h"
+
+/**
+ * \brief Monte Carlo estimation of the opponent ships for PlayerSmart, for boards that are too large for the exact counts of DensityMap -
+ * every sample is a random placement of all the remaining ships on the free cells (no ship on a blocked cell, no ships that touch each other),
+ * and the sampler counts how many samples cover every cell. sampling is anytime: it stops when the time budget (or MAX_SAMPLES) is reached.
+ * it runs on the calling thread, and optionally also on the helper threads of the tournament (see IAlgoHelperPool) - the sampler creates no threads.
+ * every thread draws with its own random engine (BattleshipGameUtils::threadRandomEngine) into its own counts.
+ * coordinates are 1-based (as in PlayerSmart)
+ */
+class PlacementSampler
+{
+public:
+	static const int MAX_SHIP_LEN = 4;
+	static const int MAX_SAMPLES = 4096;														/* per sample() call, even if there is time left */
+	static const int PLACEMENT_TRIES = 64;														/* random placements tried for a ship before the sample is dropped */
+
+	PlacementSampler() : rows(0), cols(0), depth(0), samplesNum(0), workers(1), helperPool(nullptr) {}
+
+	/* the helper threads that sample together with the calling thread (nullptr - only the calling thread) */
+	void setHelperPool(IAlgoHelperPool* pool);
+
+	/* sets the board dimensions - all the cells are free and there are no ships */
+	void init(int boardRows, int boardCols, int boardDepth);
+
+	/* sets the remaining ships - <shipSize, count> pairs, as PlayerSmart::shipsCount (negative counts are taken as 0) */
+	void setShipsCount(const std::vector<std::pair<int, int>>& shipsCount);
+
+	/* no ship can be placed on the cell (a miss, a sunk ship or a cell next to it). coordinates out of the board are ignored */
+	void block(const Coordinate& coor);
+
+	/* draws new samples (the previous counts are cleared) for budgetMicros microseconds. returns the number of samples that placed all the ships */
+	int sample(int budgetMicros);
+
+	int samplesCount() const { return samplesNum; }
+	int hits(const Coordinate& coor) const { return hitsCounts[cellIndex(coor)]; }		/* number of the last samples that cover the cell. @assume the coordinate is in the board */
+
+private:
+	int rows;
+	int cols;
+	int depth;
+	std::vector<int> shipsLens;																	/* a length for every remaining ship, the longest first (they are the hardest to place) */
+	std::vector<char> freeCells;
+	std::vector<int> hitsCounts;
+	int samplesNum;
+
+	/* the work buffers of a sampling thread */
+	struct Worker
+	{
+		std::vector<int> hitsCounts;
+		std::vector<unsigned> takenStamps;														/* a cell is taken (a ship or next to a ship) in the current sample if its stamp is the sample stamp */
+		std::vector<int> shipsCells;
+		unsigned stamp = 0;
+		int samplesNum = 0;
+	};
+	std::vector<Worker> workers;																/* a worker for every pool task - the calling thread and every helper thread */
+	IAlgoHelperPool* helperPool;
+
+	/* a sample() call - the pool tasks sample into their workers until the same deadline */
+	struct SamplingRound
+	{
+		PlacementSampler* sampler;
+		long long deadlineMicros;
+		int maxSamples;
+	};
+
+	int cellIndex(const Coordinate& coor) const { return ((coor.depth - 1) * rows + (coor.row - 1)) * cols + (coor.col - 1); }
+
+	/* a pool task of a SamplingRound - samples into workers[workerIndex] */
+	static void sampleTask(void* round, int workerIndex);
+
+	/* clears the worker counts, and samples into it until the deadline (a steady_clock time in microseconds) or until it has maxSamples samples */
+	void sampleUntil(Worker& worker, long long deadlineMicros, int maxSamples) const;
+
+	/* one random placement of all the ships, the covered cells are added to the worker counts. returns false if a ship could not be placed */
+	bool drawSample(Worker& worker) const;
+
+	/* marks the cell and its neighbors as taken in the worker current sample */
+	void takeCellAndNeighbors(Worker& worker, int index) const;
+};
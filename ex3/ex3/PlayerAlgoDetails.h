@@ -1,26 +1,96 @@
 #pragma once
 
-#include <windows.h>
+#include "AlgoLibraryLoader.h"
+#include "BuiltinAlgos.h"
 #include "IBattleshipGameAlgo.h"
+#include <memory>
 
 typedef IBattleshipGameAlgo *(*GetAlgoFuncType)();
+typedef IBattleshipGameAlgo *(*GetAlgoV2FuncType)(int);
+typedef void(*DestroyAlgoFuncType)(IBattleshipGameAlgo*);
+typedef void(*ResetAlgoFuncType)(IBattleshipGameAlgo*);
+typedef void(*SetAlgoTimeBudgetFuncType)(IBattleshipGameAlgo*, int, int);
+typedef void(*SetAlgoHelperPoolFuncType)(IBattleshipGameAlgo*, IAlgoHelperPool*);
+
+/**
+ * \brief deleter for algo instances - v2 algos are returned to their dll with DestroyAlgorithm, v1 algos are deleted by us
+ */
+struct AlgoInstanceDeleter
+{
+	DestroyAlgoFuncType destroyAlgoFunc = nullptr;
+
+	void operator()(IBattleshipGameAlgo* algo) const { if (destroyAlgoFunc) destroyAlgoFunc(algo); else delete algo; }
+};
+
+typedef std::unique_ptr<IBattleshipGameAlgo, AlgoInstanceDeleter> AlgoInstancePtr;
 
 /**
  * \brief Players data and resources - for the tournament algos vector
  */
 struct PlayerAlgoDetails
 {
-	HINSTANCE dllFileHandle;										/* dll handle. will be freed in the TournamentMangaer destructor! */
+	AlgoLibHandle dllFileHandle = nullptr;							/* dll (or .so) handle. will be freed in the TournamentMangaer destructor! */
 	std::string dllPath;											/* full path of the dll file */
 	std::string playerName;											/* short file name, without extentsion (for table) */
 	GetAlgoFuncType getAlgoFunc = nullptr;							/* pointer to the getAlgo function pointer */
+	GetAlgoV2FuncType getAlgoV2Func = nullptr;						/* v2 entry points - nullptr if the dll exports only the v1 GetAlgorithm */
+	DestroyAlgoFuncType destroyAlgoFunc = nullptr;
+	ResetAlgoFuncType resetAlgoFunc = nullptr;						/* optional also in v2 dlls */
+	SetAlgoTimeBudgetFuncType setTimeBudgetFunc = nullptr;			/* optional also in v2 dlls */
+	SetAlgoHelperPoolFuncType setHelperPoolFunc = nullptr;			/* optional also in v2 dlls */
+	int builtinAlgoIndex = BuiltinAlgos::UNDEFINED_ALGO_INDEX;		/* index in BuiltinAlgos for algos that are compiled into the exe (no dll) */
 	//int algosIndexInVec;
 	
 	PlayerAlgoDetails() = default;									
 	
 	PlayerAlgoDetails(const PlayerAlgoDetails& other) = delete;		/* deletes copy ctor */
 	
-	PlayerAlgoDetails(PlayerAlgoDetails&& otherPlayer) noexcept : dllFileHandle(std::move(otherPlayer.dllFileHandle)), dllPath(otherPlayer.dllPath), playerName(otherPlayer.playerName){ std::swap(getAlgoFunc, otherPlayer.getAlgoFunc); }		/* move constructor */
+	PlayerAlgoDetails(PlayerAlgoDetails&& otherPlayer) noexcept : dllFileHandle(std::move(otherPlayer.dllFileHandle)), dllPath(otherPlayer.dllPath), playerName(otherPlayer.playerName), builtinAlgoIndex(otherPlayer.builtinAlgoIndex)		/* move constructor */
+	{
+		std::swap(getAlgoFunc, otherPlayer.getAlgoFunc);
+		std::swap(getAlgoV2Func, otherPlayer.getAlgoV2Func);
+		std::swap(destroyAlgoFunc, otherPlayer.destroyAlgoFunc);
+		std::swap(resetAlgoFunc, otherPlayer.resetAlgoFunc);
+		std::swap(setTimeBudgetFunc, otherPlayer.setTimeBudgetFunc);
+		std::swap(setHelperPoolFunc, otherPlayer.setHelperPoolFunc);
+	}
+
+	bool isBuiltin() const { return builtinAlgoIndex != BuiltinAlgos::UNDEFINED_ALGO_INDEX; }
+
+	/* creates new algo instance, with the v2 entry points if the dll has them */
+	AlgoInstancePtr createAlgoInstance() const
+	{
+		AlgoInstanceDeleter deleter;
+		if (isBuiltin())
+			return AlgoInstancePtr(BuiltinAlgos::createAlgo(builtinAlgoIndex), deleter);
+		if (getAlgoV2Func)
+		{
+			deleter.destroyAlgoFunc = destroyAlgoFunc;
+			return AlgoInstancePtr(getAlgoV2Func(ALGO_ABI_VERSION), deleter);
+		}
+		return AlgoInstancePtr(getAlgoFunc(), deleter);
+	}
+
+	/* clears the state of an instance before it is reused in a new game (built-in algos, or if the dll exports ResetAlgorithm) */
+	void resetAlgoInstance(IBattleshipGameAlgo* algo) const
+	{
+		if (isBuiltin()) BuiltinAlgos::resetAlgo(builtinAlgoIndex, algo);
+		else if (resetAlgoFunc) resetAlgoFunc(algo);
+	}
+
+	/* passes the time budget (in microseconds, 0 is no budget) to the instance (built-in algos, or if the dll exports SetAlgorithmTimeBudget) */
+	void setAlgoTimeBudget(IBattleshipGameAlgo* algo, int moveBudgetMicros, int gameBudgetMicros) const
+	{
+		if (isBuiltin()) BuiltinAlgos::setTimeBudget(builtinAlgoIndex, algo, moveBudgetMicros, gameBudgetMicros);
+		else if (setTimeBudgetFunc) setTimeBudgetFunc(algo, moveBudgetMicros, gameBudgetMicros);
+	}
+
+	/* passes the tournament helper threads pool to the instance (built-in algos, or if the dll exports SetAlgorithmHelperPool) */
+	void setAlgoHelperPool(IBattleshipGameAlgo* algo, IAlgoHelperPool* helperPool) const
+	{
+		if (isBuiltin()) BuiltinAlgos::setHelperPool(builtinAlgoIndex, algo, helperPool);
+		else if (setHelperPoolFunc) setHelperPoolFunc(algo, helperPool);
+	}
 
 };
 
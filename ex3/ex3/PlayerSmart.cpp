@@ -1,48 +1,73 @@
 #pragma once
 #include "PlayerSmart.h"
 #include <algorithm>
+#include <cstdlib>
 #include "BattleshipBoard.h"
 
+PlayerSmart::CallTimer::CallTimer(PlayerSmart& timedPlayer) : player(timedPlayer), startMicros(0)
+{
+	if (!player.hasTimeBudget()) return;
+
+	startMicros = BattleshipGameUtils::steadyClockMicros();
+	auto callBudget = (player.moveBudgetMicros > 0 ? player.moveBudgetMicros : player.gameBudgetMicros);
+	if (player.gameBudgetMicros > 0) callBudget = std::min<long long>(callBudget, player.gameBudgetMicros - player.gameTimeUsedMicros);
+	player.callDeadlineMicros = startMicros + callBudget;
+}
+
+PlayerSmart::CallTimer::~CallTimer()
+{
+	if (player.hasTimeBudget()) player.gameTimeUsedMicros += BattleshipGameUtils::steadyClockMicros() - startMicros;
+}
+
 void PlayerSmart::setBoard(const BoardData& board)
 {
 	cleanMembers();// reset all members
+	CallTimer timer(*this);
 	boardRows = board.rows();
 	boardCols = board.cols();
 	boardDepth = board.depth();
+	attackOptions.init(boardRows, boardCols, boardDepth);
+	imbalancedAttackOptions.init(boardRows, boardCols, boardDepth);
+	permanentlyDeadCoordinates.init(boardRows, boardCols, boardDepth);
+	freeRuns.init(boardRows, boardCols, boardDepth);
+	if (targetingMode == TargetingMode::Density) densityMap.init(boardRows, boardCols, boardDepth);
+	if (targetingMode == TargetingMode::Sampling) placementSampler.init(boardRows, boardCols, boardDepth);
 	Coordinate tmpCoor(0, 0, 0);
 	Coordinate target(0, 0, 0);
-	std::set<std::pair<char, std::set<Coordinate>>> allShipsDetails; // pairs <char , {coordinates of ship}>
 	BattleshipBoard boardTemp(board); // create 
 	auto standardBase = BattleshipGameUtils::setSixOptionsVector(); // to remove the adjesent coors to the attacked coor
 	standardBase.push_back(tmpCoor); // to remove the attacked coor itself
 	
 	//standardBase vector contains {(1,0,0), (0,1,0), (0,0,1), (-1,0,0), (0,-1,0), (0,0,-1)} U {(0,0,0)}
 	//extract all shipsDetails from board
-	allShipsDetails = boardTemp.ExtractShipsDetails();
+	auto allShipsDetails = boardTemp.ExtractShipsDetails();
 
 	//create the ship's count vector
 	boardTemp.countShipsTypes(allShipsDetails, shipsCount);
 
 	// create Permenantly dead coordinates, shouldnt attak this coordinates
 	for (auto& shipDetail : allShipsDetails) { // for each ship
-		for (auto& coor : shipDetail.second) { // for each coordinate
+		for (auto cellIndex : shipDetail.cellsIndices) { // for each coordinate
+			auto coor = BattleshipGameUtils::calcCoordFromIndex(cellIndex, boardRows, boardCols);
 			updateCoordinates(target, coor.row + 1, coor.col + 1, coor.depth + 1); // move 0-9 to 1-10
 			for (auto& vic : standardBase) { // add to the curr vector
 				updateCoordinates(tmpCoor, target.row + vic.row, target.col + vic.col,target.depth + vic.depth);
 				if (isInBoard(tmpCoor.row, tmpCoor.col, tmpCoor.depth)) {
-					permanentlyDeadCoordinates.insert(tmpCoor);
+					addPermanentlyDead(tmpCoor);
 				}
 			}
 		}
 	}
 
+	updateTargetingShipsCount();
+
 	// create attackOptions
 	for (auto i = 1; i <= boardRows; i++) {
 		for (auto j = 1; j <= boardCols; j++) {
 			for (auto k = 1; k <= boardDepth; k++) {
 				if (isInBoard(i,j,k)) { // is in board and not in the surroundings my ships 
 					updateCoordinates(tmpCoor, i, j, k); //candidate attack 
-					if (!isInSet(permanentlyDeadCoordinates,tmpCoor)) {
+					if (!permanentlyDeadCoordinates.contains(tmpCoor)) {
 						attackOptions.insert(tmpCoor);
 					}
 				}
@@ -59,8 +84,9 @@ void PlayerSmart::setPlayer(int player)
 
 Coordinate PlayerSmart::attack()
 {
-	if (attackOptions.size() == 0) {
-		if (imbalancedAttackOptions.size() == 0) { // no coordinates left to attack
+	CallTimer timer(*this);
+	if (attackOptions.empty()) {
+		if (imbalancedAttackOptions.empty()) { // no coordinates left to attack
 			return Coordinate(-1, -1, -1);
 		}
 		else { // didnt win and no more attack options>> the board imbalanced
@@ -71,16 +97,78 @@ Coordinate PlayerSmart::attack()
 	if (attackedShips.size() == 0) // no ships in process 
 	{
 		// return random coordinate
-		return *BattleshipGameUtils::randomElement(attackOptions.begin(), attackOptions.end());
+		if (isGameOverBudget()) { // no time for the targeting engines
+			return attackOptions.randomCoordinate();
+		}
+		if (targetingMode == TargetingMode::Density) {
+			return maxScoreAttack([this](const Coordinate& coor) { return densityMap.density(coor); });
+		}
+		if (targetingMode == TargetingMode::Sampling && placementSampler.sample(samplingBudget()) > 0) {
+			return maxScoreAttack([this](const Coordinate& coor) { return placementSampler.hits(coor); });
+		}
+		return attackOptions.randomCoordinate();
 	}
 	// already have ships in shipsInProcess
 	return nextAttackFromCoors(attackedShips[0], attackedShips[0].shipSize);
 }
 
-void PlayerSmart::pourImbalancedToAttackOptions() {
-	for (auto& coor : imbalancedAttackOptions) {
-		attackOptions.insert(coor);
+template<typename Score>
+Coordinate PlayerSmart::maxScoreAttack(Score score) const
+{
+	auto maxScore = 0;
+	auto maxScoreNum = 0;
+	Coordinate coor(-1, -1, -1);
+
+	// the coordinates are scanned in the order of attackOptions (col, row, depth), the score is checked first - it is cheaper than the pool lookup.
+	// out of time - the best coordinate of the columns that were scanned
+	auto scannedCols = 0;
+	for (auto j = 1; j <= boardCols && (j == 1 || !isCallOverBudget()); j++, scannedCols++) {
+		for (auto i = 1; i <= boardRows; i++) {
+			for (auto k = 1; k <= boardDepth; k++) {
+				updateCoordinates(coor, i, j, k);
+				auto coorScore = score(coor);
+				if (coorScore == 0 || coorScore < maxScore || !attackOptions.contains(coor)) continue;
+				if (coorScore > maxScore) { maxScore = coorScore; maxScoreNum = 0; }
+				maxScoreNum++;
+			}
+		}
+	}
+
+	if (maxScore == 0) {	// no ship can be placed on any of the attack options (the board is imbalanced)
+		return attackOptions.randomCoordinate();
+	}
+
+	// the n-th coordinate with the max score
+	auto n = BattleshipGameUtils::randomIndex(maxScoreNum);
+	for (auto j = 1; j <= scannedCols; j++) {
+		for (auto i = 1; i <= boardRows; i++) {
+			for (auto k = 1; k <= boardDepth; k++) {
+				updateCoordinates(coor, i, j, k);
+				if (score(coor) == maxScore && attackOptions.contains(coor) && n-- == 0) return coor;
+			}
+		}
 	}
+	return Coordinate(-1, -1, -1);	// shouldnt get here
+}
+
+int PlayerSmart::samplingBudget() const
+{
+	if (!hasTimeBudget()) return SAMPLING_BUDGET_US;
+
+	auto callTimeLeft = callDeadlineMicros - BattleshipGameUtils::steadyClockMicros();
+	auto budget = (moveBudgetMicros > 0 ? callTimeLeft * SAMPLING_CALL_TIME_PERCENT / 100 : std::min<long long>(SAMPLING_BUDGET_US, callTimeLeft));
+	return static_cast<int>(std::max<long long>(budget, 0));
+}
+
+void PlayerSmart::updateTargetingShipsCount()
+{
+	if (targetingMode == TargetingMode::Density) densityMap.setShipsCount(shipsCount);
+	if (targetingMode == TargetingMode::Sampling) placementSampler.setShipsCount(shipsCount);
+}
+
+void PlayerSmart::pourImbalancedToAttackOptions() {
+	attackOptions.insertAll(imbalancedAttackOptions);
+	wallsScanNextCell = 0; // the coordinates that the walls moved are back in attackOptions - a new full scan
 }
 
 Coordinate PlayerSmart::sizeOneAttack(const Coordinate& candidate) const
@@ -92,7 +180,7 @@ Coordinate PlayerSmart::sizeOneAttack(const Coordinate& candidate) const
 	for (auto& vic : allOptions) {
 		// iterate over all possibilities to add 1/ -1 to each coordinate
 		updateCoordinates(attackCandidate, candidate.row + vic.row, candidate.col + vic.col, candidate.depth + vic.depth);
-		if (isInSet(attackOptions,attackCandidate)) {
+		if (attackOptions.contains(attackCandidate)) {
 			return attackCandidate;
 		}
 	}
@@ -116,6 +204,13 @@ void PlayerSmart::checkSixDirectionsForWalls(const Coordinate& deadCoordinate) {
 	}
 }
 
+void PlayerSmart::checkDirectionForWalls(const Coordinate& deadCoordinate, int minShipSize, int vertical, int horizontal, int direction) {
+	auto distance = countDistance(deadCoordinate, minShipSize, vertical, horizontal, direction);
+	if (distance > 0) {
+		transferCoordinatesToSecondPoll(deadCoordinate, distance, vertical, horizontal, direction);
+	}
+}
+
 void PlayerSmart::transferCoordinatesToSecondPoll(const Coordinate& startCoordinate, int numOfCoors, int vertical, int horizontal, int direction) {
 
 	Coordinate tempCoor(-1, -1, -1);
@@ -128,8 +223,8 @@ void PlayerSmart::transferCoordinatesToSecondPoll(const Coordinate& startCoordin
 	for (auto j = 1; j <= numOfCoors; j++) { 
 		updateCoordinates(tempCoor, startCoordinate.row + direction*j*vertical, 
 							startCoordinate.col + direction*j*horizontal, startCoordinate.depth + direction*j*dim);
-		if (isInSet(attackOptions, tempCoor)) {
-			delFromSet(attackOptions,tempCoor);
+		if (attackOptions.contains(tempCoor)) {
+			attackOptions.erase(tempCoor);
 			imbalancedAttackOptions.insert(tempCoor);
 		}
 	}
@@ -146,6 +241,7 @@ void PlayerSmart::updateShipsCount(int sunkShipSize) {
 
 	auto it = shipsCount.begin() + sunkShipSize - 1;
 	it->second -= 1;
+	updateTargetingShipsCount();
 
 	// if the board is imbalanced 
 	if (it->second == -1) { //this ship size doesnt exist in balanced board
@@ -200,6 +296,17 @@ int PlayerSmart::findCoorInAttackedShips(const Coordinate& coorToSearch, int sta
 	return -1;
 }
 
+void PlayerSmart::addPermanentlyDead(const Coordinate& coor)
+{
+	if (permanentlyDeadCoordinates.contains(coor)) return;
+
+	permanentlyDeadCoordinates.insert(coor);
+	freeRuns.block(coor);
+	newDeadCoordinates.push_back(coor);
+	if (targetingMode == TargetingMode::Density) densityMap.block(coor);
+	if (targetingMode == TargetingMode::Sampling) placementSampler.block(coor);
+}
+
 void PlayerSmart::cleanMembers()
 {
 	currSunkShipSize = -1;
@@ -209,22 +316,87 @@ void PlayerSmart::cleanMembers()
 	shipsCount.clear();
 	imbalancedAttackOptions.clear();
 	permanentlyDeadCoordinates.clear();
+	gameTimeUsedMicros = 0;
+	newDeadCoordinates.clear();
+	wallsScanNextCell = 0;
 }
 
 void PlayerSmart::transferAllWallsToImbalanced()
 {
-	Coordinate tmpCoor(-1, -1, -1);
+	// a walls check of a coordinate depends only on the free coordinates of its 3 lines (and on the min ship size), and it can be repeated in any order.
+	// so after the last check only the coordinates next to the new dead coordinates, or close to them on their lines, can move new coordinates to imbalanced options.
+	// out of time - both checks continue from where they stopped in the next call
+	auto minShipSize = getMinShipSize();
+	if (minShipSize != wallsCheckMinShipSize) {
+		wallsScanNextCell = 0;
+		wallsCheckMinShipSize = minShipSize;
+	}
+	if (wallsScanNextCell == 0) { // the full scan did not pass any coordinate yet - it checks the new dead coordinates too
+		newDeadCoordinates.clear();
+	}
+
+	// the new dead coordinates first - they matter only for the coordinates that the full scan already passed
+	if (checkNewDeadWalls() && wallsScanNextCell != NO_WALLS_SCAN) {
+		continueWallsScan();
+	}
+}
+
+void PlayerSmart::continueWallsScan()
+{
+	Coordinate coor(-1, -1, -1);
+	auto cellsNum = boardRows * boardCols * boardDepth;
+	auto checksNum = 0;
+	// the cells are scanned in the order of attackOptions (col, row, depth)
+	for (; wallsScanNextCell < cellsNum; wallsScanNextCell++) {
+		updateCoordinates(coor, (wallsScanNextCell / boardDepth) % boardRows + 1, wallsScanNextCell / (boardRows * boardDepth) + 1, wallsScanNextCell % boardDepth + 1);
+		if (!hasDeadNeighbor(coor)) continue;
+		if (++checksNum % WALLS_CHECKS_BETWEEN_CLOCK_CHECKS == 0 && isCallOverBudget()) return; // this coordinate is the first one of the next call
+		checkSixDirectionsForWalls(coor);
+	}
+	wallsScanNextCell = NO_WALLS_SCAN;
+}
+
+bool PlayerSmart::checkNewDeadWalls()
+{
+	Coordinate coor(-1, -1, -1);
 	std::vector<Coordinate> vic = BattleshipGameUtils::setSixOptionsVector(); // <1,0,0>, <0,1,0> <0,0,1> <-1,0,0> <0,-1,0> <0,0,-1>
-	for (auto& dead : permanentlyDeadCoordinates) {
-		for (auto& coor : vic) {
-			// iterate over all possibilities to add 1/ -1 to each coordinate
-			updateCoordinates(tmpCoor, dead.row + coor.row, dead.col + coor.col, dead.depth + coor.depth);
-			if (isInBoard(tmpCoor.row, tmpCoor.col, tmpCoor.depth)) {
-				// try to transfer coors from attack options to imbalanced options
-				checkSixDirectionsForWalls(tmpCoor);
+	auto minShipSize = getMinShipSize();
+	auto checksNum = 0;
+	for (size_t deadIndex = 0; deadIndex < newDeadCoordinates.size(); deadIndex++) {
+		if (checksNum >= WALLS_CHECKS_BETWEEN_CLOCK_CHECKS) {
+			if (isCallOverBudget()) { // the rest are checked in the next call
+				newDeadCoordinates.erase(newDeadCoordinates.begin(), newDeadCoordinates.begin() + deadIndex);
+				return false;
+			}
+			checksNum = 0;
+		}
+		// a dead coordinate out of the board only adds coordinates next to a dead coordinate. one in the board also splits the runs of its 3 lines,
+		// which matters only for the coordinates that are less than minShipSize coordinates from it
+		const auto& dead = newDeadCoordinates[deadIndex];
+		auto isDeadInBoard = isInBoard(dead.row, dead.col, dead.depth);
+		for (auto& dir : vic) {
+			for (auto dist = 1; dist == 1 || (isDeadInBoard && dist <= minShipSize); dist++) {
+				updateCoordinates(coor, dead.row + dist * dir.row, dead.col + dist * dir.col, dead.depth + dist * dir.depth);
+				if (!isInBoard(coor.row, coor.col, coor.depth)) break;
+				if (dist == 1) {
+					checkSixDirectionsForWalls(coor); // a new coordinate next to a dead coordinate
+				}
+				else if (hasDeadNeighbor(coor)) {
+					checkDirectionForWalls(coor, minShipSize, std::abs(dir.row), std::abs(dir.col), -(dir.row + dir.col + dir.depth)); // only its run towards the dead coordinate changed
+				}
+				checksNum++;
 			}
 		}
 	}
+	newDeadCoordinates.clear();
+	return true;
+}
+
+bool PlayerSmart::hasDeadNeighbor(const Coordinate& coor) const
+{
+	return permanentlyDeadCoordinates.contains(Coordinate(coor.row + 1, coor.col, coor.depth)) || permanentlyDeadCoordinates.contains(Coordinate(coor.row - 1, coor.col, coor.depth)) ||
+		permanentlyDeadCoordinates.contains(Coordinate(coor.row, coor.col + 1, coor.depth)) || permanentlyDeadCoordinates.contains(Coordinate(coor.row, coor.col - 1, coor.depth)) ||
+		permanentlyDeadCoordinates.contains(Coordinate(coor.row, coor.col, coor.depth + 1)) || permanentlyDeadCoordinates.contains(Coordinate(coor.row, coor.col, coor.depth - 1));
 }
 
 void PlayerSmart::cleanAttackOptions(const Coordinate& targetCoor) {
@@ -306,9 +478,9 @@ void PlayerSmart::removePermementlyIncrementalDirection(int shipToDelIndex)
 	if (attackedShips.at(shipToDelIndex).isDimentional) { updateToDimenIncCoors(attackedShips.at(shipToDelIndex), coorsToCheck); }
 
 	for (auto& coor : coorsToCheck) {
-		delFromSet(attackOptions, coor);
-		delFromSet(imbalancedAttackOptions, coor);
-		permanentlyDeadCoordinates.insert(coor);
+		attackOptions.erase(coor);
+		imbalancedAttackOptions.erase(coor);
+		addPermanentlyDead(coor);
 	}
 
 	if (currSunkShipSize == -1) { // to update the shipsCount vector 
@@ -374,7 +546,7 @@ Coordinate PlayerSmart::nextAttackFromCoors(const ShipInProcess& shipDetails, in
 	if (shipDetails.isDimentional) { updateToDimenIncCoors(shipDetails, coorsToCheck); }
 
 	for (auto& coor : coorsToCheck) {
-		if (isInSet(attackOptions, coor)){return coor;}
+		if (attackOptions.contains(coor)){return coor;}
 	}
 
 	return attackCandidate;
@@ -438,52 +610,16 @@ void PlayerSmart::checkConstantDirectionsForWalls(const Coordinate& attackedCoor
 }
 
 int PlayerSmart::countDistance(const Coordinate& deadCoordinate, int minShipSize, int vertical, int horizontal, int direction)const {
-	int start;
-	int count = 0;
-	Coordinate tempCoor(-1, -1, -1);
+	// the free coordinates (in attackOptions or in imbalancedAttackOptions) are exactly the coordinates in the board that are not permanently dead,
+	// so the count is the free run that starts next to deadCoordinate
+	auto axis = (vertical == 1 ? FreeRunsIndex::ROWS_AXIS : (horizontal == 1 ? FreeRunsIndex::COLS_AXIS : FreeRunsIndex::DEPTH_AXIS));
+	Coordinate start(deadCoordinate.row + direction * vertical, deadCoordinate.col + direction * horizontal, deadCoordinate.depth + direction * (axis == FreeRunsIndex::DEPTH_AXIS ? 1 : 0));
+	auto count = std::min(freeRuns.freeRun(start, axis, direction), minShipSize);
 
-	if (vertical == 1) {
-		start = deadCoordinate.row + direction;
-		updateCoordinates(tempCoor, start, deadCoordinate.col, deadCoordinate.depth);
-		// while didnt encounter permanent dead coordinate && and no room for ship contnue counting
-		while ((isInSet(attackOptions, tempCoor) || isInSet(imbalancedAttackOptions, tempCoor)) && count < minShipSize) {
-			start += direction;
-			count += 1;
-			updateCoordinates(tempCoor, start, deadCoordinate.col, deadCoordinate.depth);
-		}
-		if (count >= minShipSize) {//no need to update AttackOptions
-			return -1;
-		}
-		return count;
-	}
-	else if (horizontal == 1) {
-		start = deadCoordinate.col + direction;
-		updateCoordinates(tempCoor, deadCoordinate.row, start, deadCoordinate.depth);
-		// while didnt encounter permanent dead coordinate && and no room for ship contnue counting
-		while ((isInSet(attackOptions, tempCoor) || isInSet(imbalancedAttackOptions, tempCoor)) && count < minShipSize) {
-			start += direction;
-			count += 1;
-			updateCoordinates(tempCoor, deadCoordinate.row, start, deadCoordinate.depth);
-		}
-		if (count >= minShipSize) {//no need to update AttackOptions
-			return -1;
-		}
-		return count;
-	}
-	else {//dimentional
-		start = deadCoordinate.depth + direction;
-		updateCoordinates(tempCoor, deadCoordinate.row, deadCoordinate.col, start);
-		// while didnt encounter permanent dead coordinate && and no room for ship contnue counting
-		while ((isInSet(attackOptions, tempCoor) || isInSet(imbalancedAttackOptions, tempCoor)) && count < minShipSize) {
-			start += direction;
-			count += 1;
-			updateCoordinates(tempCoor, deadCoordinate.row, deadCoordinate.col, start);
-		}
-		if (count >= minShipSize) {//no need to update AttackOptions
-			return -1;
-		}
-		return count;
+	if (count >= minShipSize) {//no need to update AttackOptions
+		return -1;
 	}
+	return count;
 }
 
 void PlayerSmart::removePermanentlyConstDirections(const Coordinate& coor, bool isVertical, bool isHorizontal, bool isDimentional)
@@ -499,9 +635,9 @@ void PlayerSmart::removePermanentlyConstDirections(const Coordinate& coor, bool
 		BattleshipGameUtils::mergeVector(vert, BattleshipGameUtils::setDimentionalOptionsVector());
 		for (auto& vic : vert) { //vert = (0, 1, 0) , (0, -1, 0) (0, 0, -1) (0, 0, 1)
 			updateCoordinates(removeCandidate, coor.row + vic.row, coor.col + vic.col, coor.depth + vic.depth);
-			delFromSet(attackOptions,removeCandidate);
-			delFromSet(imbalancedAttackOptions,removeCandidate);
-			permanentlyDeadCoordinates.insert(removeCandidate);
+			attackOptions.erase(removeCandidate);
+			imbalancedAttackOptions.erase(removeCandidate);
+			addPermanentlyDead(removeCandidate);
 		}
 	}
 
@@ -511,9 +647,9 @@ void PlayerSmart::removePermanentlyConstDirections(const Coordinate& coor, bool
 		BattleshipGameUtils::mergeVector(horiz, BattleshipGameUtils::setDimentionalOptionsVector());
 		for (auto& vic : horiz) { //horiz = (1, 0, 0) , (-1, 0, 0) (0, 0, -1) (0, 0, 1)
 			updateCoordinates(removeCandidate, coor.row + vic.row, coor.col + vic.col, coor.depth + vic.depth);
-			delFromSet(attackOptions,removeCandidate);
-			delFromSet(imbalancedAttackOptions,removeCandidate);
-			permanentlyDeadCoordinates.insert(removeCandidate);
+			attackOptions.erase(removeCandidate);
+			imbalancedAttackOptions.erase(removeCandidate);
+			addPermanentlyDead(removeCandidate);
 		}
 	}
 
@@ -523,9 +659,9 @@ void PlayerSmart::removePermanentlyConstDirections(const Coordinate& coor, bool
 		BattleshipGameUtils::mergeVector(dimen, BattleshipGameUtils::setHorizontalOptionsVector());
 		for (auto& vic : dimen) {//dimen = (1, 0, 0) , (-1, 0, 0) (0, 1, 0) , (0, -1, 0)
 			updateCoordinates(removeCandidate, coor.row + vic.row, coor.col + vic.col, coor.depth + vic.depth);
-			delFromSet(attackOptions,removeCandidate);
-			delFromSet(imbalancedAttackOptions,removeCandidate);
-			permanentlyDeadCoordinates.insert(removeCandidate);
+			attackOptions.erase(removeCandidate);
+			imbalancedAttackOptions.erase(removeCandidate);
+			addPermanentlyDead(removeCandidate);
 		}
 	}
 }
@@ -563,15 +699,16 @@ void PlayerSmart::notifyOnAttackResult(int player, Coordinate move, AttackResult
 	int mergeResult;
 	Coordinate nextCoorTosearch(-1, -1, -1);
 	currSunkShipSize = -1;
+	CallTimer timer(*this);
 
-	if (!isInSet(attackOptions, move)) {
+	if (!attackOptions.contains(move)) {
 		return;
 	}
 
 	if (result == AttackResult::Miss) {
-		delFromSet(attackOptions,move);
-		delFromSet(imbalancedAttackOptions,move);
-		permanentlyDeadCoordinates.insert(move);
+		attackOptions.erase(move);
+		imbalancedAttackOptions.erase(move);
+		addPermanentlyDead(move);
 		checkSixDirectionsForWalls(move);
 		return;
 	}
@@ -605,9 +742,9 @@ void PlayerSmart::notifyOnAttackResult(int player, Coordinate move, AttackResult
 		if ship's size > 1 removePermementlyIncrementalDirection updates currSunkShipSize to the actual size*/
 		updateShipsCount(currSunkShipSize);
 	}
-	delFromSet(attackOptions,move);
-	delFromSet(imbalancedAttackOptions,move);
-	permanentlyDeadCoordinates.insert(move);
+	attackOptions.erase(move);
+	imbalancedAttackOptions.erase(move);
+	addPermanentlyDead(move);
 
 	// sort vector of attackedShips by size of the ship from largest ship to smallest ship - to create priority for larger ships 
 	std::sort(attackedShips.begin(), attackedShips.end(),
@@ -617,20 +754,40 @@ void PlayerSmart::notifyOnAttackResult(int player, Coordinate move, AttackResult
 	transferAllWallsToImbalanced();
 }
 
-void PlayerSmart::delFromSet(std::set<Coordinate>& data, const Coordinate & coors)
+/* the dll entry points - not compiled when PlayerSmart is linked into the tournament exe as a built-in algo */
+#ifdef ALGO_EXPORTS
+
+ALGO_API IBattleshipGameAlgo* GetAlgorithm()
 {
-	auto it = data.find(coors);
-	if (it != data.end()) { data.erase(it); }
+	IBattleshipGameAlgo* algoPtr = new PlayerSmart();
+	return algoPtr;
 }
 
-bool PlayerSmart::isInSet(const std::set<Coordinate>& data, const Coordinate & coors)
+ALGO_API IBattleshipGameAlgo* GetAlgorithmV2(int abiVersion)
 {
-	if (data.find(coors) != data.end()) { return true; }
-	return false;
+	if (abiVersion != ALGO_ABI_VERSION) return nullptr;
+	return new PlayerSmart();
 }
 
-ALGO_API IBattleshipGameAlgo* GetAlgorithm()
+/* the instance was allocated in this dll (GetAlgorithmV2), so we are the one who delete it */
+ALGO_API void DestroyAlgorithm(IBattleshipGameAlgo* algo)
 {
-	IBattleshipGameAlgo* algoPtr = new PlayerSmart();
-	return algoPtr;
-}
\ No newline at end of file
+	delete algo;
+}
+
+ALGO_API void ResetAlgorithm(IBattleshipGameAlgo* algo)
+{
+	static_cast<PlayerSmart*>(algo)->reset();
+}
+
+ALGO_API void SetAlgorithmTimeBudget(IBattleshipGameAlgo* algo, int moveBudgetMicros, int gameBudgetMicros)
+{
+	static_cast<PlayerSmart*>(algo)->setTimeBudget(moveBudgetMicros, gameBudgetMicros);
+}
+
+ALGO_API void SetAlgorithmHelperPool(IBattleshipGameAlgo* algo, IAlgoHelperPool* helperPool)
+{
+	static_cast<PlayerSmart*>(algo)->setHelperPool(helperPool);
+}
+
+#endif
@@ -2,6 +2,10 @@
 #include "ShipInProcess.h"
 #include <vector>
 #include "IBattleshipGameAlgo.h"
+#include "CoordinatesPool.h"
+#include "DensityMap.h"
+#include "PlacementSampler.h"
+#include "FreeRunsIndex.h"
 #include <set>
 
 
@@ -25,14 +29,20 @@
 * continue a sequence of coordinates that belond to the ship (up/down or left/right) and in attack options.
 *
 * if the vector of attacked ships is of size 0. return a random coordinate to attack from the set of attackOptions
+* (or, in the Density targeting mode, the coordinate of attackOptions that the most placements of the remaining ships cover - see DensityMap,
+* and in the Sampling targeting mode, the coordinate of attackOptions that the most random placements of the remaining ships cover - see PlacementSampler)
 */
 
 
-class PlayerSmart : public IBattleshipGameAlgo
+class PlayerSmart final : public IBattleshipGameAlgo
 {
 public:
 
-	PlayerSmart() :id(UNDEFINED_PLAYERID), boardRows(-1), boardCols(-1), boardDepth(-1), currSunkShipSize(-1), isBoardBalanced(true) {};
+	/* how the next coordinate is chosen when there are no ships in process */
+	enum class TargetingMode { Random, Density, Sampling };
+
+	explicit PlayerSmart(TargetingMode mode = TargetingMode::Random) :id(UNDEFINED_PLAYERID), boardRows(-1), boardCols(-1), boardDepth(-1), currSunkShipSize(-1), isBoardBalanced(true),
+		wallsScanNextCell(0), wallsCheckMinShipSize(-1), targetingMode(mode), moveBudgetMicros(0), gameBudgetMicros(0), callDeadlineMicros(0), gameTimeUsedMicros(0) {};
 	~PlayerSmart() = default;
 	PlayerSmart& operator=(const PlayerSmart& otherSmartPlayer) = delete;
 	PlayerSmart(const PlayerSmart& otherSmartPlayer) = delete;
@@ -50,8 +60,22 @@ public:
 	/* notify on last move result,update player smart by the information given*/
 	void notifyOnAttackResult(int player, Coordinate move, AttackResult result) override;
 
+	/* clear all the state of the previous game, so this instance can be reused in a new game (called from ResetAlgorithm) */
+	void reset() { cleanMembers(); id = UNDEFINED_PLAYERID; }
+
+	/* the time budget of every call (setBoard, attack, notifyOnAttackResult) and of the whole game, in microseconds (0 is no budget) - see SetAlgorithmTimeBudget.
+	when a call runs out of time the walls scan stops early and the sampling is shorter, and when the game runs out of time the hunt is random */
+	void setTimeBudget(int moveBudget, int gameBudget) { moveBudgetMicros = moveBudget; gameBudgetMicros = gameBudget; }
+
+	/* the helper threads that sample the placements together with the calling thread (only in the Sampling targeting mode) - see SetAlgorithmHelperPool */
+	void setHelperPool(IAlgoHelperPool* helperPool) { if (targetingMode == TargetingMode::Sampling) placementSampler.setHelperPool(helperPool); }
+
 private:
 	static const int UNDEFINED_PLAYERID = -1; 
+	static const int SAMPLING_BUDGET_US = 250;	/* the placements sampling time of every attack without a move budget (only in the Sampling targeting mode) */
+	static const int SAMPLING_CALL_TIME_PERCENT = 75;	/* the part of the call time left for the sampling with a move budget - the rest is for the attack scan */
+	static const int WALLS_CHECKS_BETWEEN_CLOCK_CHECKS = 64;	/* the walls scan checks the call time once in this number of cells */
+	static const int NO_WALLS_SCAN = -1;
 	int id;		// players id , if id == -1 player is invalid or undefined
 	int boardRows;
 	int boardCols;
@@ -59,100 +83,150 @@ private:
 	int currSunkShipSize;
 	bool isBoardBalanced;
 	std::vector<ShipInProcess> attackedShips; 	/*a vector of all current ship being attacked*/
-	std::set<Coordinate> attackOptions; 	/*a set of all the coordinates that are optional for attack*/
+	CoordinatesPool attackOptions; 	/*a set of all the coordinates that are optional for attack*/
 	std::vector<std::pair<int, int>> shipsCount; /*Count of assumed opponents ships count <shipSize,count> increasing order of ship's size */
-	std::set<Coordinate> imbalancedAttackOptions;// second pool of attack option if Board is Imbalanced
-	std::set<Coordinate> permanentlyDeadCoordinates;// sunk coordinates
+	CoordinatesPool imbalancedAttackOptions;// second pool of attack option if Board is Imbalanced
+	CoordinatesPool permanentlyDeadCoordinates;// sunk coordinates (and the coordinates around them, up to one coordinate out of the board)
+	FreeRunsIndex freeRuns;						/* the free runs of the board lines - the coordinates in the board that are not permanently dead */
+	std::vector<Coordinate> newDeadCoordinates;	/* the permanently dead coordinates that the walls check did not check yet */
+	int wallsScanNextCell;						/* the next cell (in the order of attackOptions) of the full walls scan, or NO_WALLS_SCAN. a new scan starts
+												 * in a new game, after a pour of the imbalanced options, and when the min ship size changes */
+	int wallsCheckMinShipSize;					/* the min ship size of the walls checks */
+	TargetingMode targetingMode;
+	DensityMap densityMap;						/* only in the Density targeting mode */
+	PlacementSampler placementSampler;			/* only in the Sampling targeting mode */
+	int moveBudgetMicros;
+	int gameBudgetMicros;
+	long long callDeadlineMicros;				/* when the current call should return (see CallTimer) */
+	long long gameTimeUsedMicros;				/* time of the calls in the current game */
+
+	/* measures a call of the player when it has a time budget - sets callDeadlineMicros, and adds the call time to gameTimeUsedMicros */
+	class CallTimer
+	{
+	public:
+		explicit CallTimer(PlayerSmart& timedPlayer);
+		~CallTimer();
+	private:
+		PlayerSmart& player;
+		long long startMicros;
+	};
+
+	bool hasTimeBudget() const { return moveBudgetMicros > 0 || gameBudgetMicros > 0; }
+	bool isCallOverBudget() const { return hasTimeBudget() && BattleshipGameUtils::steadyClockMicros() >= callDeadlineMicros; }
+	bool isGameOverBudget() const { return gameBudgetMicros > 0 && gameTimeUsedMicros >= gameBudgetMicros; }
+
+	/* adds the coordinate to permanentlyDeadCoordinates (and blocks it in the density map / placements sampler) */
+	void addPermanentlyDead(const Coordinate& coor);
+
+	/* the coordinate of attackOptions with the highest score(coor) (a random one of them if there are several), or a random coordinate if all the scores are 0.
+	if the call runs out of time, only the columns that were scanned until then are taken */
+	template<typename Score>
+	Coordinate maxScoreAttack(Score score) const;
+
+	/* the sampling time of this attack - SAMPLING_CALL_TIME_PERCENT of the call time left with a move budget, otherwise SAMPLING_BUDGET_US
+	(or less if the game is running out of time) */
+	int samplingBudget() const;
+
+	/* sets the remaining ships of the targeting engine (after shipsCount is changed) */
+	void updateTargetingShipsCount();
 
 	/* for each dead coordinate check all six directions to the next dead coordinate
-	if there isnt room for smallest ship transfer the gap to imbalanced options*/
-	void PlayerSmart::transferAllWallsToImbalanced();
+	if there isnt room for smallest ship transfer the gap to imbalanced options
+	(only the coordinates whose check may have changed since the last call are checked again, and a check that runs out of time continues in the next call) */
+	void transferAllWallsToImbalanced();
+
+	/* continues the full walls scan - checks the walls of every coordinate next to a dead coordinate, from wallsScanNextCell until the end of the board or of the call time */
+	void continueWallsScan();
+
+	/* checks the walls of the coordinates next to the new dead coordinates, or less than the min ship size from them on their lines, and removes the checked
+	dead coordinates from newDeadCoordinates. returns false if it ran out of time before it was done */
+	bool checkNewDeadWalls();
+
+	/* true if one of the 6 coordinates next to coor (in the board or one coordinate out of it) is permanently dead */
+	bool hasDeadNeighbor(const Coordinate& coor) const;
 
 	/* check all 6 directions of deadCoordinate if it became an affective "wall"
 	* if the distance from deadCoordinate to the next "wall" is less then the minimal ship
 	-this space in not opptional for atteck anymore and we move it to the second pool */
-	void PlayerSmart::checkSixDirectionsForWalls(const Coordinate& deadCoordinate);
+	void checkSixDirectionsForWalls(const Coordinate& deadCoordinate);
+
+	/* the same check for one direction (vertical, horizontal and direction as in countDistance) */
+	void checkDirectionForWalls(const Coordinate& deadCoordinate, int minShipSize, int vertical, int horizontal, int direction);
 
 	/* given a coordinate check 4 adjecent coor's that arnt in the incremental direction
 	of the ship if they are new walls*/
-	void PlayerSmart::checkConstantDirectionsForWalls(const Coordinate& attackedCoordinate, bool isVertical, bool isHorizontal, bool isDimentional);
+	void checkConstantDirectionsForWalls(const Coordinate& attackedCoordinate, bool isVertical, bool isHorizontal, bool isDimentional);
 
 	/* given a coordinate check 2 incremental edges of the ship if they are new walls*/
-	void PlayerSmart::checkIncrementalDirectionsForWalls(ShipInProcess& attackedShip);
+	void checkIncrementalDirectionsForWalls(ShipInProcess& attackedShip);
 
 	/* given a Coordinate - count the number of permanently dedCoordinates starting from startCoordinate.
 	if the distance between the "walls" is larger then the smallest ship the opponent owns
 	return -1, (= cant remove anything in this case) else return the number of coordinates that should be removed.	*/
-	int PlayerSmart::countDistance(const Coordinate& deadCoordinate, int minShipSize, int vertical, int horizontal, int direction)const;
+	int countDistance(const Coordinate& deadCoordinate, int minShipSize, int vertical, int horizontal, int direction)const;
 
 	/*move coordinate to the second pool*/
-	void PlayerSmart::transferCoordinatesToSecondPoll(const Coordinate& startCoordinate, int numOfCoors, int vertical, int horizontal, int direction);
+	void transferCoordinatesToSecondPoll(const Coordinate& startCoordinate, int numOfCoors, int vertical, int horizontal, int direction);
 
 	/* assume the ships handled here are of size at least 2. remove the incremental
 	edges of the sunk ship and remove the ship from the attacked ships vector*/
-	void PlayerSmart::removePermementlyIncrementalDirection(int shipToDelIndex);
+	void removePermementlyIncrementalDirection(int shipToDelIndex);
 
 	/* update setToUpdate to contain the coordinates that are not in the ship but adjecnt to the incremental edges*/
-	static void PlayerSmart::updateToVerticalIncCoors(const ShipInProcess& targetShip , std::set<Coordinate>& setToUpdate);
+	static void updateToVerticalIncCoors(const ShipInProcess& targetShip , std::set<Coordinate>& setToUpdate);
 	
 	/* update setToUpdate to contain the coordinates that are not in the ship but adjecnt to the incremental edges*/
-	static void PlayerSmart::updateToHorizIncCoors(const ShipInProcess& targetShip, std::set<Coordinate>& setToUpdate);
+	static void updateToHorizIncCoors(const ShipInProcess& targetShip, std::set<Coordinate>& setToUpdate);
 	
 	/* update setToUpdate to contain the coordinates that are not in the ship but adjecnt to the incremental edges*/
-	static void PlayerSmart::updateToDimenIncCoors(const ShipInProcess& targetShip, std::set<Coordinate>& setToUpdate);
+	static void updateToDimenIncCoors(const ShipInProcess& targetShip, std::set<Coordinate>& setToUpdate);
 
 	/*remove the coors 4 adjecent coordinates. that arnt in the incremental direction*/
-	void PlayerSmart::removePermanentlyConstDirections(const Coordinate& coor, bool isVertical, bool isHorizontal, bool isDimentional);
+	void removePermanentlyConstDirections(const Coordinate& coor, bool isVertical, bool isHorizontal, bool isDimentional);
 
 	/*for a given coordinate check if its edges are walls*/
-	void PlayerSmart::cleanAttackOptions(const Coordinate & targetCoor);
+	void cleanAttackOptions(const Coordinate & targetCoor);
 
 	/*for each coordinate in the surrounding of the ship if not in the incremental direction check if a wall*/
-	void PlayerSmart::cleanAttackOptions(const ShipInProcess& shipToClean, const Coordinate& attacked);
+	void cleanAttackOptions(const ShipInProcess& shipToClean, const Coordinate& attacked);
 
 	/* given a set of coordinates that belong to 1 ship return the next coordinate to attack	*/
-	Coordinate PlayerSmart::nextAttackFromCoors(const ShipInProcess& shipDetails, int numOfCoors) const;
+	Coordinate nextAttackFromCoors(const ShipInProcess& shipDetails, int numOfCoors) const;
 
 	/*pours all content of imbalancedAttackOptions to attackOptions to continue the imbalanced game  */
-	void PlayerSmart::pourImbalancedToAttackOptions();
+	void pourImbalancedToAttackOptions();
 
 	/* given a coordinate check all the coordinates (up/down/lwft/rgiht/in/out) and attack them if werent attacked yet.*/
-	Coordinate PlayerSmart::sizeOneAttack(const Coordinate& candidate) const;
+	Coordinate sizeOneAttack(const Coordinate& candidate) const;
 
 	/*given the size of the ship that sunk,update that there is one less ship in this size
 	if after the update the number of ships of size sunkShipSize is -1, the board was imbalanced
 	set isBoardBalanced = false and update the attack options pool	*/
-	void PlayerSmart::updateShipsCount(int sunkShipSize);
+	void updateShipsCount(int sunkShipSize);
 
 	/*return the size of the other player's curr smallest ship */
-	int PlayerSmart::getMinShipSize() const;
+	int getMinShipSize() const;
 
 	/* given a coordinate search attackedships and check if it belongs to one of them.
 	if found a ship it belongs to -  update this ship details and return the index of the ship it was added to.
 	else return -1 [the ship sunk|| was added as new] .
 	if the ship sunk(of size 1), update sunkShipSize to -1*/
-	int PlayerSmart::addCoorToShipInProcess(const Coordinate& targetCoor, Coordinate* nextCoorTosearch, AttackResult result);
+	int addCoorToShipInProcess(const Coordinate& targetCoor, Coordinate* nextCoorTosearch, AttackResult result);
 
 	/* given startIndex(of the ship we want to add coordinates to) and coorToSearch.
 	look for the coordinate in all attacked ships starting from index, if found, merge the 2 ships
 	and remove the second ship from attacked ships*/
-	void PlayerSmart::mergeShipDetails(Coordinate* pair, int indexToupdate);
+	void mergeShipDetails(Coordinate* pair, int indexToupdate);
 
 	/*iterate over attackShips vector starting from startIndex, and for each shipinprocess
 	check if coor belongs to the ship if does return its coordinate else return -1*/
-	int PlayerSmart::findCoorInAttackedShips(const Coordinate& coorToSearch, int startIndex);
+	int findCoorInAttackedShips(const Coordinate& coorToSearch, int startIndex);
 
 	/*checking if a current coordinate is within board Limits*/
-	bool  PlayerSmart::isInBoard(int row, int col, int depth) const;
+	bool  isInBoard(int row, int col, int depth) const;
 
 	/* clear member fields from previous runs*/
-	void PlayerSmart::cleanMembers();
-
-	/*remove coordinate from given set*/
-	static void delFromSet(std::set<Coordinate>& data, const Coordinate& coors);
-
-	/*true iff coor in data*/
-	static bool isInSet(const std::set<Coordinate>& data, const Coordinate& coors);
+	void cleanMembers();
 
 	/* given origin update its coordinates to <row,col,depth>*/
 	static void updateCoordinates(Coordinate& origin, int row, int col, int depth) { origin.row = row; origin.col = col; origin.depth = depth; }
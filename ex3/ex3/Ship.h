@@ -1,60 +1,29 @@
 #pragma once
 
-#include <map> // std:: map
-#include <utility> //  std::pair
-#include <set> // std::set
 #include <vector> // std::vector
-#include "IBattleshipGameAlgo.h"
-#include <list>
 #include "BattleshipGameUtils.h"		/* for the Coordinate operator*/
+#include "BattleshipBoard.h"			/* for ShipDetails */
 
 
+/* the ship types rules of the game - the size, shape and points of every ship type.
+ * the game state of the ships is kept in ShipsBoard */
+
 class Ship {
-	friend class ShipsBoard;
 public:
 
-	/*
-	* input.first - ship's letter, input.second - coordinates for the ship
-	* @ assume letter is one of b/p/m/d/B/P/M/D
-	*/
-	explicit Ship(std::pair<char, std::set<Coordinate>> input);
-
-	~Ship() = default;
-	
-	Ship(const Ship& otherShip) = delete;
-	
-	Ship(Ship&& otherShip) noexcept : symbol(otherShip.symbol), len(otherShip.len), points(otherShip.points), notHit(otherShip.notHit){ std::swap(body, otherShip.body); }
-
-
-	/* returns how much score is gained by hitting this ship*/
-	int getPoints()const;
-
-	/* returns how many parts of the body not hit yet*/
-	int getNotHit()const;
-
-	/*return true- if ship not sank yet
-	* false- otherwise
-	*/
-	bool isAlive()const;
-
-	std::vector<Coordinate> Ship::getCoordinates();
+	Ship() = delete;
 
-	/*@ret: 0 - in case of hitting this coordinate for the first time
-	1 - this coordinates were already attacked in the past
-	-1 - the coordinates given are not of this ship
-	*/
-	int updateAttack(int row, int col, int depth);
-
-	/* given <symbol, set of coordinates>
-	@ return true - if data in input.second corresponds to a ship of type input.first
+	/* given ship details (found in a board)
+	@ return true - if the ship cells corresponds to a ship of type shipDetails.symbol
 	* false - otherwise
 	*/
-	static bool Ship::isValidShipDetails(std::pair<char, std::set<Coordinate>> input);
+	static bool isValidShipDetails(const ShipDetails& shipDetails);
 
-	/* @return a list of Battleships, given a set of all ships details
-	* @assume- each entry in allpairs cooresponeds to a valid ship
-	*/
-	static std::list<Ship> Ship::createShipsList(const std::set<std::pair<char, std::set<Coordinate>>>& allPairs);
+	/* returns how much score is gained by sinking a ship of this letter (-1 if it is not a ship letter) */
+	static int getShipPoints(char symbol);
+
+	/* returns the number of cells of a ship of this letter (-1 if it is not a ship letter) */
+	static int getShipLen(char symbol);
 
 	private:
 
@@ -66,34 +35,18 @@ public:
 	static const int ROCKET_SHIP_LEN = 2;
 	static const int SUBMARINE_LEN = 3;
 	static const int DESTROYER_LEN = 4;
-
-	char symbol; // ship's representing letter
-	int len; // ship length
-	int points; // how much earned by sinking the ship
-	int notHit; //how much not hit   
-	std::map<Coordinate, int> body; // <<row,col>,0/1> 0- not hit; 1- hit
-
-											 /* updates ship's fields according to the input values
-											 */
-	void setFields(int length, int sPoints, std::set<Coordinate>  coordinates);
+	static const int RUBBER_BOAT_POINTS = 2;
+	static const int ROCKET_SHIP_POINTS = 3;
+	static const int SUBMARINE_POINTS = 7;
+	static const int DESTROYER_POINTS = 8;
 
 	/*@return - true if ship with symbol= id can have 'setSize' number of coordinates
 	*/
-	static bool Ship::isValidShipLen(char id, size_t setSize);
+	static bool isValidShipLen(char id, size_t setSize);
 
 	/*
-	@return -true if ship is horizontal/vertical otherwise false
-	*/
-	static bool isValidShipCoordinates(const std::set<Coordinate>& coordinates);
-
-	/*@ return true if all coordinates are equal
-	@assume- coors vector is sorted
-	*/
-	static bool isConstantCoors(const std::vector<int>& coors);
-
-	/*@ return true if coordinates are incremenal (&& with no gaps)
-	@assume- coors vector is sorted
+	@return -true if ship is horizontal/vertical/dimentional otherwise false
 	*/
-	static bool isIncrementalCoors(const std::vector<int>& coors);
+	static bool isValidShipCoordinates(const ShipDetails& shipDetails);
 
 }; 
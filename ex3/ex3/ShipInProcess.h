@@ -24,7 +24,7 @@ class ShipInProcess
 	int shipSize;//current ship size
 
 	/* update the state of the inner Fields of the shipinproccess.assumes ship has 1 coordinate and firstcoor<secondCoor*/
-	void ShipInProcess::updateInnerFields(bool vertical, bool horizontal, bool dimensional, int firstCoor, int secondCoor);
+	void updateInnerFields(bool vertical, bool horizontal, bool dimensional, int firstCoor, int secondCoor);
 
 	/* assumes the ship is of size 1, if coordinate belongs to the ship add and return 1, else return -1*/
 	int addToSizeOneShip(int row, int col, int depth);
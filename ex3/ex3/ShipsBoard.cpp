@@ -1,51 +1,30 @@
 #include "ShipsBoard.h"
 
+const ShipsBoardTemplate::ShipIndex ShipsBoardTemplate::NO_SHIP;
 
-ShipsBoard::ShipsBoard( std::list<Ship>& inputShipsList, int Rows, int Cols, int Depth) : rows(Rows), cols(Cols), depth(Depth), shipsList(std::move(inputShipsList)), shipsBoardVec(Rows*Cols*Depth)
+ShipsBoardTemplate::ShipsBoardTemplate(const std::vector<ShipDetails>& shipsDetails, int Rows, int Cols, int Depth) : rows(Rows), cols(Cols), depth(Depth), shipIndexGrid(Rows*Cols*Depth, NO_SHIP), partIndexGrid(Rows*Cols*Depth, 0)
 {
-	/*shipsBoardVec entries already set to nullptr */
-	
-	/* for each ship in the list, go over all its coordinates and put a pointer in the ships Board */
-	for (auto &ship : shipsList) {
-		for (auto& part : ship.body) {
-			setShipPtrCoord(part.first.row, part.first.col, part.first.depth, &ship);
+	shipsPoints.reserve(shipsDetails.size());
+	shipsSunkMasks.reserve(shipsDetails.size());
+
+	/* for each ship, add it to the table, and go over all its cells and put its index and the part index in the grids */
+	for (auto& shipDetails : shipsDetails)
+	{
+		auto shipIndex = static_cast<ShipIndex>(shipsPoints.size());
+		auto partsNum = static_cast<int>(shipDetails.cellsIndices.size());
+		shipsPoints.push_back(Ship::getShipPoints(shipDetails.symbol));
+		shipsSunkMasks.push_back(static_cast<uint8_t>((1u << partsNum) - 1));
+
+		for (auto part = 0; part < partsNum; part++)
+		{
+			shipIndexGrid[shipDetails.cellsIndices[part]] = shipIndex;
+			partIndexGrid[shipDetails.cellsIndices[part]] = static_cast<uint8_t>(part);
 		}
 	}
 }
 
 
-ShipsBoard::ShipsBoard(ShipsBoard && otherBoard) noexcept : rows(otherBoard.rows), cols(otherBoard.cols), depth(otherBoard.depth) 
+ShipsBoard::ShipsBoard(const ShipsBoardTemplate& boardTemplate, MonotonicArena* gameArena) : rows(boardTemplate.rows), cols(boardTemplate.cols), depth(boardTemplate.depth), shipsTemplate(&boardTemplate),
+	shipsHitsMasks(boardTemplate.shipsNum(), 0, ArenaAllocator<uint8_t>(gameArena))
 {
-	/* steal the ships objects and the pointers to us */
-	std::swap(shipsBoardVec, otherBoard.shipsBoardVec);
-	std::swap(shipsList, otherBoard.shipsList);
-}
-
-ShipsBoard & ShipsBoard::operator=(ShipsBoard && otherBoard) noexcept
-{
-	rows = otherBoard.rows;
-	cols = otherBoard.cols;
-	depth = otherBoard.depth;
-	
-	/* steal the ships objects and the pointers to us */
-	std::swap(shipsBoardVec, otherBoard.shipsBoardVec);
-	std::swap(shipsList, otherBoard.shipsList);
-
-	return *this;
-}
-
-
-void ShipsBoard::setShipPtrCoord(int r, int c, int d, Ship* newShipPtr)
-{
-
-	if (!isCoordianteInShipBoard(r, c, d)) return;
-	shipsBoardVec[BattleshipGameUtils::calcCoordIndex(r, c, d, rows, cols)] = newShipPtr;					/* assign ship pointer to the relevant coordinate in shipsBoardVec*/
-}
-
-/* for easy access */
-Ship* ShipsBoard::operator()(int r, int c, int d) const
-{
-	if(isCoordianteInShipBoard(r, c, d))
-		return shipsBoardVec[BattleshipGameUtils::calcCoordIndex(r, c, d, rows, cols)];
-	else return nullptr;
 }
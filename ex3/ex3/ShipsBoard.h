@@ -1,30 +1,83 @@
 #pragma once
 #include <vector>
+#include <cstdint>
 #include "Ship.h"
 #include "BattleshipGameUtils.h"
+#include "MonotonicArena.h"
 
-/* Created for the (single) game manager */
+/**
+ * \brief the immutable part of a player's ships board - the ships table and the ship index and part index of every cell.
+ * built once for every board of the tournament (see BoardGameTemplate), and shared by all the games on this board
+ */
+struct ShipsBoardTemplate
+{
+	typedef uint16_t ShipIndex;
+	static const ShipIndex NO_SHIP = UINT16_MAX;
+	static const size_t MAX_SHIPS_NUM = NO_SHIP;													/* the ship indices are [0, MAX_SHIPS_NUM) */
+	static const int MAX_SHIP_PARTS = 8;															/* the bits of a ship hits mask */
+
+	int rows = 0;
+	int cols = 0;
+	int depth = 0;
+
+	/* the ships table - an array for every field, indexed by the ship index */
+	std::vector<int> shipsPoints;																	/* how much score is gained by sinking this ship */
+	std::vector<uint8_t> shipsSunkMasks;															/* the hits mask of the ship when it is sunk - a bit for every part */
+
+	/* 1D vectors that represent the 3D board (see BattleshipGameUtils::calcCoordIndex) */
+	std::vector<ShipIndex> shipIndexGrid;															/* for every cell, the ship index in the ships table (or NO_SHIP) */
+	std::vector<uint8_t> partIndexGrid;																/* for every ship cell, the part of the ship in it (its bit in the ship hits mask) */
+
+	ShipsBoardTemplate() = default;
+
+	/* given the (valid) ships details of the player, creates the ships table and the grids
+	 * @assume - at most MAX_SHIPS_NUM ships, every ship with at most MAX_SHIP_PARTS parts */
+	ShipsBoardTemplate(const std::vector<ShipDetails>& shipsDetails, int Rows, int Cols, int Depth);
+
+	int shipsNum() const { return static_cast<int>(shipsPoints.size()); }
+};
+
+/* Created for the (single) game manager - the game state of the player ships: the hits mask of every ship */
 
 class ShipsBoard
 {
 public:
-	ShipsBoard() : rows(0), cols(0), depth(0) {}
-	ShipsBoard(std::list<Ship>& ShipsSet, int Rows, int Cols, int Depth);
+	ShipsBoard() : rows(0), cols(0), depth(0), shipsTemplate(nullptr) {}
+	/* the template must live as long as this board. the ships state is allocated from gameArena, or from the heap if it is nullptr */
+	explicit ShipsBoard(const ShipsBoardTemplate& boardTemplate, MonotonicArena* gameArena = nullptr);
+
+	~ShipsBoard() = default;
 
-	~ShipsBoard() = default;																		/* shipsBoardVec pointers will be deleted automatically when shipList will destruct	*/
-	
 	ShipsBoard(const ShipsBoard& otherBoard) = delete;												/* deletes copy constructor */
 	ShipsBoard& operator=(const ShipsBoard& otherBoard) = delete;									/* deletes copy assignment */
 
-	ShipsBoard(ShipsBoard&& otherBoard) noexcept;													/* move constructor */
-	ShipsBoard& operator=(ShipsBoard&& otherBoard) noexcept;										/* move assignment */
+	ShipsBoard(ShipsBoard&& otherBoard) noexcept = default;											/* move constructor */
+	ShipsBoard& operator=(ShipsBoard&& otherBoard) noexcept = default;								/* move assignment */
 
 	int Rows() const { return rows; }
 	int Cols() const { return cols; }
 	int Depth() const { return depth; }
-	
-	
-	Ship* operator() (int r, int c, int d)const;
+
+	/* the index of the given (0-based) coordinate in the grids
+	 * @assume - the coordinate is in the board */
+	int cellIndex(int r, int c, int d) const { return BattleshipGameUtils::calcCoordIndex(r, c, d, rows, cols); }
+
+	/* returns the index of the ship in the given cell, or ShipsBoardTemplate::NO_SHIP */
+	int shipIndexAt(int cellIndex) const { return shipsTemplate->shipIndexGrid[cellIndex]; }
+	bool isShipAlive(int shipIndex) const { return shipsHitsMasks[shipIndex] != shipsTemplate->shipsSunkMasks[shipIndex]; }
+	int shipPoints(int shipIndex) const { return shipsTemplate->shipsPoints[shipIndex]; }
+
+	/* marks the part of the ship in the given cell as hit. returns true if it was hit for the first time, false if it was already hit before
+	 * @assume - shipIndex is the ship in this cell */
+	bool updateAttack(int shipIndex, int cellIndex)
+	{
+		auto partBit = static_cast<uint8_t>(1u << shipsTemplate->partIndexGrid[cellIndex]);
+		if (shipsHitsMasks[shipIndex] & partBit) return false;									/* my coordinates but already hit before */
+
+		shipsHitsMasks[shipIndex] |= partBit;
+		return true;
+	}
+
 	/* checks if given coordinate is a valid location in board*/
 	bool isCoordianteInShipBoard(int r, int c, int d)const { return BattleshipGameUtils::isCoordianteInBoard(r, c, d, rows, cols, depth); };
 
@@ -33,9 +86,6 @@ private:
 	int rows;
 	int cols;
 	int depth;
-	std::list<Ship> shipsList;																		/* to maintain the ships objects*/
-	std::vector<Ship*> shipsBoardVec;																/* 1D vector that represents 3D board of pointers to ships objects*/
-
-	void setShipPtrCoord(int r, int c, int d, Ship* newShip);
-
+	const ShipsBoardTemplate* shipsTemplate;														/* the ships table and grids - not owned */
+	std::vector<uint8_t, ArenaAllocator<uint8_t>> shipsHitsMasks;									/* for every ship in the ships table - a bit for every part that was hit */
 };
@@ -1,6 +1,6 @@
 #pragma once
 
-/* will be element of the tournament games queue*/
+/* will be element of the tournament games schedule */
 
 class SingleGameProperties
 {
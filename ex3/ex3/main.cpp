@@ -16,6 +16,8 @@ int main(int argc, char* argv[])
 	{
 		return -1;
 	}
+#ifdef _WIN32
 	system("pause");
+#endif
 	return 0;
 }
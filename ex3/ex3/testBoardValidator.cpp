@@ -0,0 +1,248 @@
+#include "testBoardValidator.h"
+#include <cctype>
+
+namespace
+{
+	const char BLANK_CHAR = BattleshipBoard::BLANK_CHAR;									/* a copy - the class constant is not defined out of the class */
+	const std::string SHIPS_CHARS("BPMDbpmd");
+	const int SHIPS_LENS[BoardValidationReport::SHIP_TYPES_NUM] = { 1, 2, 3, 4 };			/* by the order of SHIPS_CHARS */
+
+	int playerOfShip(char shipChar) { return isupper(shipChar) ? 0 : 1; }
+	int typeOfShip(char shipChar) { return static_cast<int>(SHIPS_CHARS.find(static_cast<char>(toupper(shipChar)))); }
+}
+
+int testBoardValidator::testvalidateFixedBoards()
+{
+	struct FixedBoard { const char* name; int rows, cols; std::vector<std::string> layers; bool isValid; };
+	const FixedBoard fixedBoards[] = {
+		{ "valid", 5, 5, { "B   b"
+						   "     "
+						   "PP pp"
+						   "     "
+						   "M   m" ,
+						   "     "
+						   "     "
+						   "     "
+						   "     "
+						   "M   m" ,
+						   "     "
+						   "     "
+						   "     "
+						   "     "
+						   "M   m" }, true },
+		{ "adjacent ships", 3, 4, { "Bb  "
+									"    "
+									"DDDD" ,
+									"   d"
+									"   d"
+									"   d" }, false },
+		{ "adjacent in depth", 2, 2, { "B   ", "b   " }, false },
+		{ "wrong size and shape", 4, 4, { "PPP "
+										  "    "
+										  "mm m"
+										  "m  m" }, false },
+		{ "no ships for player B", 3, 3, { "B  "
+										   "   "
+										   "  P" }, false },
+		{ "imbalanced ship types", 3, 5, { "B   b"
+										   "     "
+										   "PP mm" }, false },
+		{ "empty", 2, 3, { "      " }, false },
+	};
+
+	for (const auto& fixedBoard : fixedBoards)
+	{
+		auto board = boardFromLayers(fixedBoard.layers, fixedBoard.rows, fixedBoard.cols);
+		auto report = BoardValidator::validate(board);
+		if (!compareReports(report, referenceValidate(board), fixedBoard.cols, fixedBoard.rows)) {
+			std::cout << "error in validate of the board: " << fixedBoard.name << std::endl;
+		}
+		if (report.isValid() != fixedBoard.isValid) {
+			std::cout << "error in isValid of the board: " << fixedBoard.name << std::endl;
+		}
+	}
+
+	std::cout << "testvalidateFixedBoards is Done!!!!!" << std::endl;
+	return 0;
+}
+
+int testBoardValidator::testvalidateRandomBoards()
+{
+	const int boardsDims[][3] = { { 1, 1, 1 }, { 10, 10, 1 }, { 6, 7, 3 }, { 1, 64, 2 }, { 9, 9, 9 } };
+	std::mt19937 randomGen(2017);
+
+	for (const auto& dims : boardsDims)
+	{
+		for (auto i = 0; i < 100; i++)
+		{
+			auto board = (i % 2 == 0 ? randomCharsBoard(randomGen, dims[0], dims[1], dims[2]) : randomShipsBoard(randomGen, dims[0], dims[1], dims[2]));
+			if (!compareReports(BoardValidator::validate(board), referenceValidate(board), dims[1], dims[0])) {
+				std::cout << "error in validate of random board " << i << " of " << dims[0] << "x" << dims[1] << "x" << dims[2] << std::endl;
+			}
+		}
+	}
+
+	std::cout << "testvalidateRandomBoards is Done!!!!!" << std::endl;
+	return 0;
+}
+
+testBoardValidator::ReferenceReport testBoardValidator::referenceValidate(const BattleshipBoard& board)
+{
+	ReferenceReport expected;
+	const int rows = board.getRows(), cols = board.getCols(), depth = board.getDepth();
+	std::vector<std::vector<std::vector<char>>> boardCopy(rows, std::vector<std::vector<char>>(cols, std::vector<char>(depth)));
+
+	for (auto r = 0; r < rows; r++)
+	{
+		for (auto c = 0; c < cols; c++)
+		{
+			for (auto d = 0; d < depth; d++)
+			{
+				auto currChar = board(r, c, d);
+				boardCopy[r][c][d] = currChar;
+				if (currChar == BLANK_CHAR) continue;
+
+				expected.shipsCellsNum[playerOfShip(currChar)]++;
+				for (const auto& nearbyCoord : board.getNearbyCoordinates(Coordinate(r, c, d)))
+				{
+					auto nearbyChar = board(nearbyCoord.row, nearbyCoord.col, nearbyCoord.depth);
+					if (nearbyChar != BLANK_CHAR && nearbyChar != currChar) expected.hasAdjacentShips = true;
+				}
+			}
+		}
+	}
+	if (expected.shipsCellsNum[0] == 0 || expected.shipsCellsNum[1] == 0) return expected;
+
+	/* extracts every ship from the copy, and deletes its cells */
+	for (auto r = 0; r < rows; r++)
+	{
+		for (auto c = 0; c < cols; c++)
+		{
+			for (auto d = 0; d < depth; d++)
+			{
+				auto shipChar = boardCopy[r][c][d];
+				if (shipChar == BLANK_CHAR) continue;
+
+				std::set<Coordinate> shipCoords;
+				std::vector<Coordinate> toVisit(1, Coordinate(r, c, d));
+				boardCopy[r][c][d] = BLANK_CHAR;
+				while (!toVisit.empty())
+				{
+					auto currCoord = toVisit.back();
+					toVisit.pop_back();
+					shipCoords.insert(currCoord);
+					for (const auto& nearbyCoord : board.getNearbyCoordinates(currCoord))
+					{
+						if (boardCopy[nearbyCoord.row][nearbyCoord.col][nearbyCoord.depth] != shipChar) continue;
+						boardCopy[nearbyCoord.row][nearbyCoord.col][nearbyCoord.depth] = BLANK_CHAR;
+						toVisit.push_back(nearbyCoord);
+					}
+				}
+
+				/* a valid ship is a straight line of the length of its type */
+				std::set<int> shipRows, shipCols, shipDepths;
+				for (const auto& coord : shipCoords)
+				{
+					shipRows.insert(coord.row);
+					shipCols.insert(coord.col);
+					shipDepths.insert(coord.depth);
+				}
+				auto shipLen = static_cast<int>(shipCoords.size());
+				auto isStraight = (shipRows.size() == 1) + (shipCols.size() == 1) + (shipDepths.size() == 1) >= 2;	/* the cells are connected - so a line has no holes */
+
+				auto playerId = playerOfShip(shipChar);
+				if (shipLen == SHIPS_LENS[typeOfShip(shipChar)] && isStraight) {
+					expected.validShips[playerId].insert(std::make_pair(shipChar, shipCoords));
+					expected.shipsTypesCount[playerId][typeOfShip(shipChar)]++;
+				}
+				else expected.invalidShipsChars[playerId].insert(shipChar);
+			}
+		}
+	}
+	return expected;
+}
+
+bool testBoardValidator::compareReports(const BoardValidationReport& report, const ReferenceReport& expected, int boardCols, int boardRows)
+{
+	if (report.hasAdjacentShips != expected.hasAdjacentShips) return false;
+
+	for (auto playerId = 0; playerId < BoardValidationReport::PLAYERS_NUM; playerId++)
+	{
+		if (report.shipsCellsNum[playerId] != expected.shipsCellsNum[playerId] || report.invalidShipsChars[playerId] != expected.invalidShipsChars[playerId]) return false;
+
+		for (auto shipType = 0; shipType < BoardValidationReport::SHIP_TYPES_NUM; shipType++)
+			if (report.shipsTypesCount[playerId][shipType] != expected.shipsTypesCount[playerId][shipType]) return false;
+
+		std::set<std::pair<char, std::set<Coordinate>>> validShips;
+		for (const auto& ship : report.validShips[playerId])
+		{
+			std::set<Coordinate> shipCoords;
+			for (auto cellIndex : ship.cellsIndices)
+				shipCoords.insert(BattleshipGameUtils::calcCoordFromIndex(cellIndex, boardRows, boardCols));
+			if (shipCoords.size() != ship.cellsIndices.size()) return false;
+			validShips.insert(std::make_pair(ship.symbol, shipCoords));
+		}
+		if (validShips.size() != report.validShips[playerId].size()) return false;
+		if (validShips < expected.validShips[playerId] || expected.validShips[playerId] < validShips) return false;	/* Coordinate has no operator== */
+	}
+	return true;
+}
+
+BattleshipBoard testBoardValidator::boardFromLayers(const std::vector<std::string>& layers, int rows, int cols)
+{
+	std::vector<char> boardVec;
+	for (const auto& layer : layers)
+		boardVec.insert(boardVec.end(), layer.begin(), layer.end());						/* a layer is rows * cols chars, by the board vector order */
+	return BattleshipBoard(boardVec, rows, cols, static_cast<int>(layers.size()));
+}
+
+BattleshipBoard testBoardValidator::randomCharsBoard(std::mt19937& randomGen, int rows, int cols, int depth)
+{
+	std::vector<char> boardVec(rows * cols * depth, BLANK_CHAR);
+	for (auto& cell : boardVec)
+	{
+		if (randomGen() % 4 == 0) cell = SHIPS_CHARS[randomGen() % SHIPS_CHARS.size()];
+	}
+	return BattleshipBoard(boardVec, rows, cols, depth);
+}
+
+BattleshipBoard testBoardValidator::randomShipsBoard(std::mt19937& randomGen, int rows, int cols, int depth)
+{
+	std::vector<char> boardVec(rows * cols * depth, BLANK_CHAR);
+	auto shipsNum = 1 + static_cast<int>(randomGen() % (rows * cols * depth / 8 + 2));
+
+	for (auto i = 0; i < shipsNum; i++)
+	{
+		auto shipChar = SHIPS_CHARS[randomGen() % SHIPS_CHARS.size()];
+		auto shipLen = SHIPS_LENS[typeOfShip(shipChar)] + (randomGen() % 6 == 0 ? 1 : 0) - (randomGen() % 6 == 0 ? 1 : 0);
+		auto axis = randomGen() % 3;
+		int r = randomGen() % rows, c = randomGen() % cols, d = randomGen() % depth;
+
+		std::vector<int> shipCells;
+		for (auto j = 0; j < shipLen && r < rows && c < cols && d < depth; j++)
+		{
+			shipCells.push_back((d * rows + r) * cols + c);
+			if (axis == 0) r++;
+			else if (axis == 1) c++;
+			else d++;
+		}
+		/* most ships keep away from the previous ships, the others may touch or cross them */
+		auto isTouching = false;
+		for (auto cellIndex : shipCells)
+		{
+			auto coord = BattleshipGameUtils::calcCoordFromIndex(cellIndex, rows, cols);
+			const int nearby[][3] = { { 0, 0, 0 }, { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+			for (const auto& step : nearby)
+			{
+				Coordinate nearbyCoord(coord.row + step[0], coord.col + step[1], coord.depth + step[2]);
+				if (BattleshipGameUtils::isCoordianteInBoard(nearbyCoord.row, nearbyCoord.col, nearbyCoord.depth, rows, cols, depth) &&
+					boardVec[(nearbyCoord.depth * rows + nearbyCoord.row) * cols + nearbyCoord.col] != BLANK_CHAR) isTouching = true;
+			}
+		}
+		if (isTouching && randomGen() % 4 != 0) continue;
+
+		for (auto cellIndex : shipCells)
+			boardVec[cellIndex] = shipChar;
+	}
+	return BattleshipBoard(boardVec, rows, cols, depth);
+}
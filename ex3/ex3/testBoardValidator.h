@@ -0,0 +1,38 @@
+#pragma once
+#include "BoardValidator.h"
+#include <iostream>
+#include <random>
+#include <string>
+
+/* compares BoardValidator with the board checks of the tournament manager before BoardValidator (checkBoardValidity) -
+ * adjacent ships by the nearby coordinates of every cell, and ships as sets of coordinates extracted from a copy of the board */
+
+class testBoardValidator {
+public:
+	testBoardValidator() {};
+	~testBoardValidator() {};
+
+	/* small valid and invalid boards (adjacent ships, wrong size or shape, a player without ships, imbalanced ship types) */
+	static int testvalidateFixedBoards();
+
+	/* random boards - random ship chars, and random straight ships (some of them too long or too short) */
+	static int testvalidateRandomBoards();
+
+	/* what checkBoardValidity found in the board */
+	struct ReferenceReport
+	{
+		std::set<std::pair<char, std::set<Coordinate>>> validShips[BoardValidationReport::PLAYERS_NUM];
+		std::set<char> invalidShipsChars[BoardValidationReport::PLAYERS_NUM];
+		int shipsTypesCount[BoardValidationReport::PLAYERS_NUM][BoardValidationReport::SHIP_TYPES_NUM] = {};
+		int shipsCellsNum[BoardValidationReport::PLAYERS_NUM] = {};
+		bool hasAdjacentShips = false;
+	};
+
+	static ReferenceReport referenceValidate(const BattleshipBoard& board);
+	static bool compareReports(const BoardValidationReport& report, const ReferenceReport& expected, int boardCols, int boardRows);
+
+	// boards
+	static BattleshipBoard boardFromLayers(const std::vector<std::string>& layers, int rows, int cols);
+	static BattleshipBoard randomCharsBoard(std::mt19937& randomGen, int rows, int cols, int depth);
+	static BattleshipBoard randomShipsBoard(std::mt19937& randomGen, int rows, int cols, int depth);
+};
@@ -0,0 +1,186 @@
+#include "testCompiledBoard.h"
+#include "BoardValidator.h"
+#include <fstream>
+#include <cstdio>
+
+namespace
+{
+	const std::string BOARD_PATH("testCompiledBoard.sboard");
+	const std::string COMPILED_PATH("testCompiledBoard.sboardb");
+
+	/* a valid 4x5x2 board - 40 cells, so the cells part has no padding and every byte of the file is checked */
+	const std::string BOARD_CONTENT("5x4x2\n"
+									"\n"
+									"B   b\n"
+									"     \n"
+									"PP pp\n"
+									"     \n"
+									"\n"
+									"     \n"
+									"MMM  \n"
+									"     \n"
+									"  mmm\n");
+}
+
+int testCompiledBoard::testwriteAndLoad()
+{
+	if (!writeTextFile(BOARD_PATH, BOARD_CONTENT) || !compileBoardFile(BOARD_PATH, COMPILED_PATH)) {
+		std::cout << "error in writing the compiled board" << std::endl;
+		return 0;
+	}
+
+	BattleshipBoard parsedBoard(BOARD_PATH);
+	auto report = BoardValidator::validate(parsedBoard);
+
+	BattleshipBoard loadedBoard;
+	std::vector<ShipDetails> shipsA, shipsB;
+	uint64_t sourceHash, sourceSize, expectedHash, expectedSize;
+	if (!CompiledBoard::load(COMPILED_PATH, BOARD_PATH, loadedBoard, shipsA, shipsB, sourceHash, sourceSize)) {
+		std::cout << "error in loading the compiled board" << std::endl;
+	}
+	else {
+		if (loadedBoard.getRows() != parsedBoard.getRows() || loadedBoard.getCols() != parsedBoard.getCols() || loadedBoard.getDepth() != parsedBoard.getDepth()) {
+			std::cout << "error in the compiled board dimensions" << std::endl;
+		}
+		else {
+			for (auto r = 0; r < parsedBoard.getRows(); r++)
+				for (auto c = 0; c < parsedBoard.getCols(); c++)
+					for (auto d = 0; d < parsedBoard.getDepth(); d++)
+						if (loadedBoard(r, c, d) != parsedBoard(r, c, d)) std::cout << "error in the compiled board cell <" << r << "," << c << "," << d << ">" << std::endl;
+		}
+
+		if (!compareShipsDetails(shipsA, report.validShips[0]) || !compareShipsDetails(shipsB, report.validShips[1])) {
+			std::cout << "error in the compiled board ships" << std::endl;
+		}
+
+		if (!BattleshipGameUtils::hashFileContent(BOARD_PATH, expectedHash, expectedSize) || sourceHash != expectedHash || sourceSize != expectedSize) {
+			std::cout << "error in the compiled board source hash" << std::endl;
+		}
+	}
+
+	std::remove(COMPILED_PATH.c_str());
+	std::remove(BOARD_PATH.c_str());
+	std::cout << "testwriteAndLoad is Done!!!!!" << std::endl;
+	return 0;
+}
+
+int testCompiledBoard::testloadStaleSource()
+{
+	if (!writeTextFile(BOARD_PATH, BOARD_CONTENT) || !compileBoardFile(BOARD_PATH, COMPILED_PATH)) {
+		std::cout << "error in writing the compiled board" << std::endl;
+		return 0;
+	}
+
+	auto changedContent = BOARD_CONTENT;
+	changedContent[changedContent.find('B')] = 'b';												/* the same size, another content */
+	writeTextFile(BOARD_PATH, changedContent);
+	if (tryLoad(COMPILED_PATH, BOARD_PATH)) {
+		std::cout << "error - a compiled board of a changed .sboard was loaded" << std::endl;
+	}
+
+	writeTextFile(BOARD_PATH, BOARD_CONTENT + "\n");
+	if (tryLoad(COMPILED_PATH, BOARD_PATH)) {
+		std::cout << "error - a compiled board of a longer .sboard was loaded" << std::endl;
+	}
+
+	std::remove(BOARD_PATH.c_str());
+	if (tryLoad(COMPILED_PATH, BOARD_PATH)) {
+		std::cout << "error - a compiled board without its .sboard was loaded" << std::endl;
+	}
+
+	std::remove(COMPILED_PATH.c_str());
+	std::cout << "testloadStaleSource is Done!!!!!" << std::endl;
+	return 0;
+}
+
+int testCompiledBoard::testloadCorruptedFiles()
+{
+	std::vector<char> compiledContent;
+	if (!writeTextFile(BOARD_PATH, BOARD_CONTENT) || !compileBoardFile(BOARD_PATH, COMPILED_PATH) || !readBinaryFile(COMPILED_PATH, compiledContent)) {
+		std::cout << "error in writing the compiled board" << std::endl;
+		return 0;
+	}
+	if (!tryLoad(COMPILED_PATH, BOARD_PATH)) {
+		std::cout << "error in loading the compiled board" << std::endl;
+	}
+
+	for (size_t len = 0; len < compiledContent.size(); len++)
+	{
+		writeBinaryFile(COMPILED_PATH, std::vector<char>(compiledContent.begin(), compiledContent.begin() + len));
+		if (tryLoad(COMPILED_PATH, BOARD_PATH)) std::cout << "error - a compiled board truncated to " << len << " bytes was loaded" << std::endl;
+	}
+
+	for (size_t i = 0; i < compiledContent.size(); i++)
+	{
+		auto corruptedContent = compiledContent;
+		corruptedContent[i] ^= 0x5A;
+		writeBinaryFile(COMPILED_PATH, corruptedContent);
+		if (tryLoad(COMPILED_PATH, BOARD_PATH)) std::cout << "error - a compiled board with a corrupted byte " << i << " was loaded" << std::endl;
+	}
+
+	auto longerContent = compiledContent;
+	longerContent.push_back(0);
+	writeBinaryFile(COMPILED_PATH, longerContent);
+	if (tryLoad(COMPILED_PATH, BOARD_PATH)) {
+		std::cout << "error - a compiled board with a trailing byte was loaded" << std::endl;
+	}
+
+	std::remove(COMPILED_PATH.c_str());
+	std::remove(BOARD_PATH.c_str());
+	std::cout << "testloadCorruptedFiles is Done!!!!!" << std::endl;
+	return 0;
+}
+
+bool testCompiledBoard::writeTextFile(const std::string& filePath, const std::string& content)
+{
+	std::ofstream outFile(filePath, std::ios::binary | std::ios::trunc);
+	outFile << content;
+	return outFile.good();
+}
+
+bool testCompiledBoard::readBinaryFile(const std::string& filePath, std::vector<char>& content)
+{
+	std::ifstream inFile(filePath, std::ios::binary);
+	if (!inFile.is_open()) return false;
+	content.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+	return true;
+}
+
+bool testCompiledBoard::writeBinaryFile(const std::string& filePath, const std::vector<char>& content)
+{
+	std::ofstream outFile(filePath, std::ios::binary | std::ios::trunc);
+	outFile.write(content.data(), content.size());
+	return outFile.good();
+}
+
+bool testCompiledBoard::compileBoardFile(const std::string& boardPath, const std::string& compiledPath)
+{
+	BattleshipBoard board(boardPath);
+	if (!board.isSuccessfullyCreated()) return false;
+
+	auto report = BoardValidator::validate(board);
+	return report.isValid() && CompiledBoard::write(compiledPath, boardPath, board, report.validShips[0], report.validShips[1]);
+}
+
+bool testCompiledBoard::compareShipsDetails(const std::vector<ShipDetails>& ships1, const std::vector<ShipDetails>& ships2)
+{
+	if (ships1.size() != ships2.size()) return false;
+
+	for (size_t i = 0; i < ships1.size(); i++)
+	{
+		const auto& ship1 = ships1[i];
+		const auto& ship2 = ships2[i];
+		if (ship1.symbol != ship2.symbol || ship1.cellsIndices != ship2.cellsIndices) return false;
+		if (ship1.minCoord.row != ship2.minCoord.row || ship1.minCoord.col != ship2.minCoord.col || ship1.minCoord.depth != ship2.minCoord.depth) return false;
+		if (ship1.maxCoord.row != ship2.maxCoord.row || ship1.maxCoord.col != ship2.maxCoord.col || ship1.maxCoord.depth != ship2.maxCoord.depth) return false;
+	}
+	return true;
+}
+
+bool testCompiledBoard::tryLoad(const std::string& compiledPath, const std::string& boardPath)
+{
+	BattleshipBoard board;
+	std::vector<ShipDetails> shipsA, shipsB;
+	uint64_t sourceHash, sourceSize;
+	return CompiledBoard::load(compiledPath, boardPath, board, shipsA, shipsB, sourceHash, sourceSize);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include "CompiledBoard.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+/* writes a .sboardb of a small board, loads it back, and checks that every stale or corrupted compiled board is rejected */
+
+class testCompiledBoard {
+public:
+	testCompiledBoard() {};
+	~testCompiledBoard() {};
+
+	/* the loaded board and ships are the written ones */
+	static int testwriteAndLoad();
+
+	/* a compiled board of an older content of the .sboard is not loaded */
+	static int testloadStaleSource();
+
+	/* every truncation of the file, a flip of any of its bytes and a trailing byte - the load fails (and the fallback parses the .sboard) */
+	static int testloadCorruptedFiles();
+
+	// helpers
+	static bool writeTextFile(const std::string& filePath, const std::string& content);
+	static bool readBinaryFile(const std::string& filePath, std::vector<char>& content);
+	static bool writeBinaryFile(const std::string& filePath, const std::vector<char>& content);
+	static bool compileBoardFile(const std::string& boardPath, const std::string& compiledPath);
+	static bool compareShipsDetails(const std::vector<ShipDetails>& ships1, const std::vector<ShipDetails>& ships2);
+	static bool tryLoad(const std::string& compiledPath, const std::string& boardPath);
+};
@@ -0,0 +1,111 @@
+#include "testCoordinatesPool.h"
+#include <random>
+#include <vector>
+#include <algorithm>
+
+int testCoordinatesPool::testatMatchesSet()
+{
+	const int boardsDims[][3] = { { 1, 1, 1 }, { 10, 10, 1 }, { 4, 7, 3 }, { 15, 15, 15 } };
+	std::mt19937 randomGen(2017);
+
+	for (const auto& dims : boardsDims)
+	{
+		CoordinatesPool pool;
+		std::set<Coordinate> expected;
+		pool.init(dims[0], dims[1], dims[2]);
+
+		for (auto i = 0; i < 4000; i++)
+		{
+			/* 0 and dim + 1 are the padding, -1 and dim + 2 are out of the pool */
+			Coordinate coor(std::uniform_int_distribution<int>(-1, dims[0] + 2)(randomGen), std::uniform_int_distribution<int>(-1, dims[1] + 2)(randomGen),
+				std::uniform_int_distribution<int>(-1, dims[2] + 2)(randomGen));
+			auto isInPool = coor.row >= 0 && coor.row <= dims[0] + 1 && coor.col >= 0 && coor.col <= dims[1] + 1 && coor.depth >= 0 && coor.depth <= dims[2] + 1;
+
+			if (randomGen() % 3 != 0) {
+				pool.insert(coor);
+				if (isInPool) expected.insert(coor);
+			}
+			else {
+				pool.erase(coor);
+				expected.erase(coor);
+			}
+
+			if (i % 97 == 0 && !comparePoolToSet(pool, expected, dims[0], dims[1], dims[2])) {
+				std::cout << "error in CoordinatesPool of board " << dims[0] << "x" << dims[1] << "x" << dims[2] << " after " << i << " changes" << std::endl;
+				break;
+			}
+		}
+		if (!comparePoolToSet(pool, expected, dims[0], dims[1], dims[2])) {
+			std::cout << "error in CoordinatesPool of board " << dims[0] << "x" << dims[1] << "x" << dims[2] << " at the end" << std::endl;
+		}
+	}
+
+	std::cout << "testatMatchesSet is Done!!!!!" << std::endl;
+	return 0;
+}
+
+int testCoordinatesPool::testinsertAllAndClear()
+{
+	const int rows = 6, cols = 5, depth = 4;
+	std::mt19937 randomGen(1948);
+	CoordinatesPool pool1, pool2;
+	std::set<Coordinate> expected;
+	pool1.init(rows, cols, depth);
+	pool2.init(rows, cols, depth);
+
+	for (auto i = 0; i < 150; i++)
+	{
+		Coordinate coor(std::uniform_int_distribution<int>(0, rows + 1)(randomGen), std::uniform_int_distribution<int>(0, cols + 1)(randomGen), std::uniform_int_distribution<int>(0, depth + 1)(randomGen));
+		if (i % 2 == 0) pool1.insert(coor);
+		else pool2.insert(coor);
+		expected.insert(coor);
+	}
+
+	pool1.insertAll(pool2);
+	if (!comparePoolToSet(pool1, expected, rows, cols, depth)) {
+		std::cout << "error in insertAll" << std::endl;
+	}
+
+	pool1.clear();
+	if (!comparePoolToSet(pool1, std::set<Coordinate>(), rows, cols, depth)) {
+		std::cout << "error in clear" << std::endl;
+	}
+
+	pool1.insert(Coordinate(rows + 1, cols + 1, depth + 1));									/* the dimensions are kept - the last padding cell is still in the pool */
+	if (pool1.size() != 1 || !compareCoordinates(pool1.at(0), Coordinate(rows + 1, cols + 1, depth + 1))) {
+		std::cout << "error in insert after clear" << std::endl;
+	}
+
+	std::cout << "testinsertAllAndClear is Done!!!!!" << std::endl;
+	return 0;
+}
+
+bool testCoordinatesPool::comparePoolToSet(const CoordinatesPool& pool, const std::set<Coordinate>& expected, int rows, int cols, int depth)
+{
+	if (pool.size() != static_cast<int>(expected.size()) || pool.empty() != expected.empty()) return false;
+
+	auto k = 0;
+	for (const auto& coor : expected)
+	{
+		if (!compareCoordinates(pool.at(k++), coor)) return false;
+	}
+
+	std::vector<Coordinate> poolOrder;
+	pool.forEach([&poolOrder](const Coordinate& coor) { poolOrder.push_back(coor); });
+	if (poolOrder.size() != expected.size() || !std::equal(poolOrder.begin(), poolOrder.end(), expected.begin(), compareCoordinates)) return false;
+
+	for (auto r = -1; r <= rows + 2; r++)
+	{
+		for (auto c = -1; c <= cols + 2; c++)
+		{
+			for (auto d = -1; d <= depth + 2; d++)
+				if (pool.contains(Coordinate(r, c, d)) != (expected.count(Coordinate(r, c, d)) != 0)) return false;
+		}
+	}
+	return true;
+}
+
+bool testCoordinatesPool::compareCoordinates(const Coordinate& coor1, const Coordinate& coor2)
+{
+	return coor1.row == coor2.row && coor1.col == coor2.col && coor1.depth == coor2.depth;
+}
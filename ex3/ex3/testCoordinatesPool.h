@@ -0,0 +1,22 @@
+#pragma once
+#include "CoordinatesPool.h"
+#include <iostream>
+#include <set>
+
+/* compares CoordinatesPool with a std::set<Coordinate> (the attack pools of PlayerSmart before CoordinatesPool) */
+
+class testCoordinatesPool {
+public:
+	testCoordinatesPool() {};
+	~testCoordinatesPool() {};
+
+	/* random inserts and erases (also on the padding and out of it) - the size, contains, at(k) and forEach must be as in the set */
+	static int testatMatchesSet();
+
+	/* insertAll is the union of the pools, and clear keeps the dimensions */
+	static int testinsertAllAndClear();
+
+	// compare functions
+	static bool comparePoolToSet(const CoordinatesPool& pool, const std::set<Coordinate>& expected, int rows, int cols, int depth);
+	static bool compareCoordinates(const Coordinate& coor1, const Coordinate& coor2);
+};
@@ -0,0 +1,94 @@
+#include "testFreeRunsIndex.h"
+#include <random>
+
+int testFreeRunsIndex::testfreeRunMatchesLineWalk()
+{
+	const int boardsDims[][3] = { { 1, 1, 1 }, { 10, 10, 1 }, { 4, 7, 3 }, { 15, 15, 15 } };
+	std::mt19937 randomGen(2017);
+
+	for (const auto& dims : boardsDims)
+	{
+		const int rows = dims[0], cols = dims[1], depth = dims[2];
+		FreeRunsIndex freeRuns;
+		std::vector<bool> blockedCells(rows * cols * depth, false);
+		freeRuns.init(rows, cols, depth);
+
+		auto blocksNum = rows * cols * depth;													/* with the repeated blocks, about 2/3 of the cells end blocked */
+		for (auto i = 0; i < blocksNum; i++)
+		{
+			Coordinate coor(std::uniform_int_distribution<int>(0, rows + 1)(randomGen), std::uniform_int_distribution<int>(0, cols + 1)(randomGen),
+				std::uniform_int_distribution<int>(0, depth + 1)(randomGen));
+			freeRuns.block(coor);
+			if (coor.row >= 1 && coor.row <= rows && coor.col >= 1 && coor.col <= cols && coor.depth >= 1 && coor.depth <= depth)
+				blockedCells[((coor.depth - 1) * rows + (coor.row - 1)) * cols + (coor.col - 1)] = true;
+
+			if ((i % 61 == 0 || i == blocksNum - 1) && !compareAllRuns(freeRuns, blockedCells, rows, cols, depth)) {
+				std::cout << "error in FreeRunsIndex of board " << rows << "x" << cols << "x" << depth << " after " << i + 1 << " blocks" << std::endl;
+				break;
+			}
+		}
+	}
+
+	std::cout << "testfreeRunMatchesLineWalk is Done!!!!!" << std::endl;
+	return 0;
+}
+
+int testFreeRunsIndex::testfreeBoardRuns()
+{
+	FreeRunsIndex freeRuns;
+	freeRuns.init(3, 5, 2);
+
+	if (freeRuns.freeRun(Coordinate(1, 1, 1), FreeRunsIndex::COLS_AXIS, 1) != 5 || freeRuns.freeRun(Coordinate(1, 2, 1), FreeRunsIndex::COLS_AXIS, -1) != 2) {
+		std::cout << "error in freeRun along the cols" << std::endl;
+	}
+	if (freeRuns.freeRun(Coordinate(2, 4, 2), FreeRunsIndex::ROWS_AXIS, 1) != 2 || freeRuns.freeRun(Coordinate(2, 4, 2), FreeRunsIndex::DEPTH_AXIS, -1) != 2) {
+		std::cout << "error in freeRun along the rows / depth" << std::endl;
+	}
+	if (freeRuns.freeRun(Coordinate(0, 1, 1), FreeRunsIndex::ROWS_AXIS, 1) != 0 || freeRuns.freeRun(Coordinate(1, 6, 1), FreeRunsIndex::COLS_AXIS, -1) != 0) {
+		std::cout << "error in freeRun out of the board" << std::endl;
+	}
+
+	freeRuns.block(Coordinate(1, 3, 1));
+	if (freeRuns.freeRun(Coordinate(1, 1, 1), FreeRunsIndex::COLS_AXIS, 1) != 2 || freeRuns.freeRun(Coordinate(1, 5, 1), FreeRunsIndex::COLS_AXIS, -1) != 2 ||
+		freeRuns.freeRun(Coordinate(1, 3, 1), FreeRunsIndex::ROWS_AXIS, 1) != 0 || freeRuns.freeRun(Coordinate(2, 3, 1), FreeRunsIndex::ROWS_AXIS, -1) != 1) {
+		std::cout << "error in freeRun after a block" << std::endl;
+	}
+
+	std::cout << "testfreeBoardRuns is Done!!!!!" << std::endl;
+	return 0;
+}
+
+int testFreeRunsIndex::walkFreeRun(const std::vector<bool>& blockedCells, int rows, int cols, int depth, Coordinate start, FreeRunsIndex::Axis axis, int direction)
+{
+	auto count = 0;
+	for (auto coor = start; coor.row >= 1 && coor.row <= rows && coor.col >= 1 && coor.col <= cols && coor.depth >= 1 && coor.depth <= depth; count++)
+	{
+		if (blockedCells[((coor.depth - 1) * rows + (coor.row - 1)) * cols + (coor.col - 1)]) break;
+
+		if (axis == FreeRunsIndex::ROWS_AXIS) coor.row += direction;
+		else if (axis == FreeRunsIndex::COLS_AXIS) coor.col += direction;
+		else coor.depth += direction;
+	}
+	return count;
+}
+
+bool testFreeRunsIndex::compareAllRuns(const FreeRunsIndex& freeRuns, const std::vector<bool>& blockedCells, int rows, int cols, int depth)
+{
+	/* the starts out of the board (0 and dim + 1) must have no run */
+	for (auto r = 0; r <= rows + 1; r++)
+	{
+		for (auto c = 0; c <= cols + 1; c++)
+		{
+			for (auto d = 0; d <= depth + 1; d++)
+			{
+				for (auto a = 0; a < FreeRunsIndex::AXES_NUM; a++)
+				{
+					auto axis = static_cast<FreeRunsIndex::Axis>(a);
+					for (auto direction : { 1, -1 })
+						if (freeRuns.freeRun(Coordinate(r, c, d), axis, direction) != walkFreeRun(blockedCells, rows, cols, depth, Coordinate(r, c, d), axis, direction)) return false;
+				}
+			}
+		}
+	}
+	return true;
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include "FreeRunsIndex.h"
+#include <iostream>
+#include <vector>
+
+/* compares FreeRunsIndex with a plain walk over the board lines (the distance count of PlayerSmart before FreeRunsIndex) */
+
+class testFreeRunsIndex {
+public:
+	testFreeRunsIndex() {};
+	~testFreeRunsIndex() {};
+
+	/* random blocks (also repeated and out of the board) - freeRun of every cell, axis and direction must be the walk of its line */
+	static int testfreeRunMatchesLineWalk();
+
+	/* the runs of a board without blocks, and of the cells out of the board */
+	static int testfreeBoardRuns();
+
+	// the reference - walks from start along the axis until a blocked cell or the board end
+	static int walkFreeRun(const std::vector<bool>& blockedCells, int rows, int cols, int depth, Coordinate start, FreeRunsIndex::Axis axis, int direction);
+	static bool compareAllRuns(const FreeRunsIndex& freeRuns, const std::vector<bool>& blockedCells, int rows, int cols, int depth);
+};